@@ -9,6 +9,8 @@
 #include <CLI/App.hpp>
 #include <fmt/format.h>
 
+#include <algorithm>
+
 #include <pl/core/ast/ast_node_array_variable_decl.hpp>
 #include <pl/core/ast/ast_node_bitfield.hpp>
 #include <pl/core/ast/ast_node_enum.hpp>
@@ -172,7 +174,11 @@ namespace pl::cli::sub {
 
                 {
                     std::string sectionContent;
-                    for (const auto &[name, type] : runtime.getInternals().parser->getTypes()) {
+                    // Document types in alphabetical order, the type table keeps them in declaration order
+                    std::vector<core::TypeTable::Entry> types(runtime.getInternals().parser->getTypes().begin(), runtime.getInternals().parser->getTypes().end());
+                    std::ranges::sort(types, {}, &core::TypeTable::Entry::first);
+
+                    for (const auto &[name, type] : types) {
                         if (!type->shouldDocument())
                             continue;
                         if (hideImplementationDetails && name.contains("impl::"))
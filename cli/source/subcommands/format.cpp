@@ -16,6 +16,7 @@ namespace pl::cli::sub {
         static std::fs::path inputFilePath, outputFilePath, patternFilePath;
         static std::vector<std::fs::path> includePaths;
         static std::vector<std::string> defines;
+        static std::fs::path cachePath;
 
         static std::string formatterName;
         static bool verbose = false;
@@ -31,6 +32,7 @@ namespace pl::cli::sub {
         subcommand->add_option("-o,--output,OUTPUT_FILE", outputFilePath, "File to write the pattern data to")->check(CLI::NonexistentPath);
         subcommand->add_option("-I,--includes", includePaths, "Include file paths")->take_all()->check(CLI::ExistingDirectory);
         subcommand->add_option("-D,--define", defines, "Define a preprocessor macro")->take_all();
+        subcommand->add_option("-c,--cache", cachePath, "Directory to cache the tokens of included files in");
         subcommand->add_option("-b,--base", baseAddress, "Base address")->default_val(0x00);
         subcommand->add_flag("-v,--verbose", verbose, "Verbose output")->default_val(false);
         subcommand->add_flag("-d,--dangerous", allowDangerousFunctions, "Allow dangerous functions")->default_val(false);
@@ -95,6 +97,8 @@ namespace pl::cli::sub {
                 }
             });
 
+            runtime.setTokenCachePath(cachePath);
+
             if (int exitCode = pl::cli::executePattern(runtime, inputFile, patternFile, includePaths, defines, allowDangerousFunctions, baseAddress); exitCode != 0)
                 throw ExitException(exitCode);
 
@@ -7,6 +7,8 @@
 #include <CLI/App.hpp>
 #include <fmt/format.h>
 
+#include <algorithm>
+
 namespace pl::cli::sub {
 
     void addRunSubcommand(CLI::App *app, pl::PatternLanguage &runtime) {
@@ -15,10 +17,13 @@ namespace pl::cli::sub {
         static std::string formatterName;
         static bool verbose = false;
         static bool allowDangerousFunctions = false;
+        static bool releaseMode = false;
+        static u32 benchmarkIterations = 0;
         static u64 baseAddress = 0x00;
         static std::vector<std::string> defines;
 
         static std::fs::path inputFilePath, patternFilePath;
+        static std::fs::path cachePath;
 
         auto subcommand = app->add_subcommand("run");
 
@@ -28,8 +33,11 @@ namespace pl::cli::sub {
         subcommand->add_option("-I,--includes", includePaths, "Include file paths")->take_all()->check(CLI::ExistingDirectory);
         subcommand->add_option("-b,--base", baseAddress, "Base address")->default_val(0x00);
         subcommand->add_option("-D,--define", defines, "Define a preprocessor macro")->take_all();
+        subcommand->add_option("-c,--cache", cachePath, "Directory to cache the tokens of included files in");
         subcommand->add_flag("-v,--verbose", verbose, "Verbose output")->default_val(false);
         subcommand->add_flag("-d,--dangerous", allowDangerousFunctions, "Allow dangerous functions")->default_val(false);
+        subcommand->add_flag("-r,--release", releaseMode, "Evaluate without debugging support")->default_val(false);
+        subcommand->add_option("--benchmark", benchmarkIterations, "Execute the pattern the given number of times and print the average running time")->default_val(0);
 
         subcommand->callback([&runtime] {
             // Configure Pattern Language runtime
@@ -43,6 +51,8 @@ namespace pl::cli::sub {
                 runtime.addDefine(define);
 
             runtime.setIncludePaths(includePaths);
+            runtime.setTokenCachePath(cachePath);
+            runtime.setEvaluationMode(releaseMode ? core::EvaluationMode::Release : core::EvaluationMode::Debuggable);
 
             auto data = wolv::io::File(inputFilePath, wolv::io::File::Mode::Read).readVector();
             runtime.setDataSource(baseAddress, data.size(), [&](u64 address, void *buffer, size_t size) {
@@ -75,19 +85,28 @@ namespace pl::cli::sub {
             });
 
             // Execute pattern file
-            if (int result = runtime.executeFile(patternFilePath); result != 0) {
-                auto compileErrors = runtime.getCompileErrors();
-                if (!compileErrors.empty()) {
-                    fmt::print("Compilation failed\n");
-                    for (const auto &error : compileErrors) {
-                        fmt::print("{}\n", error.format());
+            const auto iterations = std::max<u32>(benchmarkIterations, 1);
+            double runningTime = 0;
+            for (u32 i = 0; i < iterations; i += 1) {
+                if (int result = runtime.executeFile(patternFilePath); result != 0) {
+                    auto compileErrors = runtime.getCompileErrors();
+                    if (!compileErrors.empty()) {
+                        fmt::print("Compilation failed\n");
+                        for (const auto &error : compileErrors) {
+                            fmt::print("{}\n", error.format());
+                        }
+                    } else {
+                        auto error = runtime.getEvalError().value();
+                        fmt::print("Pattern Error: {}:{} -> {}\n", error.line, error.column, error.message);
                     }
-                } else {
-                    auto error = runtime.getEvalError().value();
-                    fmt::print("Pattern Error: {}:{} -> {}\n", error.line, error.column, error.message);
+                    throw ExitException(result);
                 }
-                throw ExitException(result);
+
+                runningTime += runtime.getLastRunningTime();
             }
+
+            if (benchmarkIterations > 0)
+                fmt::print("Average running time over {} runs: {:.6f}s\n", iterations, runningTime / iterations);
         });
     }
 
@@ -6,9 +6,13 @@
 #include <pl/helpers/utils.hpp>
 
 #include <cmath>
+#include <concepts>
 #include <vector>
+#include <span>
 #include <functional>
 #include <string>
+#include <string_view>
+#include <memory>
 #include <optional>
 #include <atomic>
 
@@ -38,13 +42,23 @@ namespace pl::api {
     using Resolver = std::function<hlp::Result<Source*, std::string>(const std::string&)>;
 
     struct Source {
-        std::string content;
+        std::string_view content;
         std::string source;
         u32 id = 0;
         bool mainSource = false;
 
-         Source(std::string content, std::string source = DefaultSource, bool mainSource = false) :
-            content(std::move(content)), source(std::move(source)), mainSource(mainSource) {
+        Source(std::string content, std::string source = DefaultSource, bool mainSource = false) :
+            Source(std::make_shared<const std::string>(std::move(content)), std::move(source), mainSource) { }
+
+        /**
+         * @brief Creates a source that shares an existing immutable content buffer
+         * @note Copies of the source refer to the same buffer, so the content is never copied again
+         * @param buffer Content of the source, must not be null
+         * @param source Name of the source
+         * @param mainSource Whether this is the main source
+         */
+        Source(std::shared_ptr<const std::string> buffer, std::string source = DefaultSource, bool mainSource = false) :
+            content(*buffer), source(std::move(source)), mainSource(mainSource), m_buffer(std::move(buffer)) {
             this->id = pl::hlp::stringCrc32(this->source);
         }
 
@@ -60,6 +74,12 @@ namespace pl::api {
             return this->id <=> other.id;
         }
 
+        [[nodiscard]] const std::shared_ptr<const std::string>& getBuffer() const {
+            return this->m_buffer;
+        }
+
+    private:
+        std::shared_ptr<const std::string> m_buffer;
     };
 
     /**
@@ -123,6 +143,19 @@ namespace pl::api {
      */
     using FunctionCallback  = std::function<std::optional<core::Token::Literal>(core::Evaluator *, const std::vector<core::Token::Literal> &)>;
 
+    /**
+     * @brief A function callback called when a function is called. The parameters are a view into the evaluator's argument stack
+     * and are only valid for the duration of the call.
+     */
+    using FunctionSpanCallback = std::function<std::optional<core::Token::Literal>(core::Evaluator *, std::span<const core::Token::Literal>)>;
+
+    /**
+     * @brief Callables that can be registered as a span based function
+     */
+    template<typename T>
+    concept SpanFunctionCallback = !std::same_as<std::remove_cvref_t<T>, FunctionCallback> &&
+                                   std::is_invocable_r_v<std::optional<core::Token::Literal>, T&, core::Evaluator *, std::span<const core::Token::Literal>>;
+
     /**
      * @brief A function callback called when a custom built-in type is being instantiated
      */
@@ -134,7 +167,7 @@ namespace pl::api {
     struct Function {
         FunctionParameterCount parameterCount;
         std::vector<core::Token::Literal> defaultParameters;
-        FunctionCallback func;
+        FunctionSpanCallback func;
     };
 
 }
\ No newline at end of file
@@ -28,6 +28,7 @@ namespace pl::core::ast {
         void setLocation(const Location &location);
 
         [[nodiscard]] virtual std::unique_ptr<ASTNode> evaluate(Evaluator *evaluator) const;
+        [[nodiscard]] virtual std::optional<Token::Literal> evaluateValue(Evaluator *evaluator) const;
         virtual void createPatterns(Evaluator *evaluator, std::vector<std::shared_ptr<ptrn::Pattern>> &resultPatterns) const;
         virtual FunctionResult execute(Evaluator *evaluator) const;
 
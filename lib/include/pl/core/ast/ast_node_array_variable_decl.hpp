@@ -37,6 +37,10 @@ namespace pl::core::ast {
             return this->m_placementOffset;
         }
 
+        [[nodiscard]] const std::unique_ptr<ASTNode> &getPlacementSection() const {
+            return this->m_placementSection;
+        }
+
         [[nodiscard]] bool isConstant() const {
             return this->m_constant;
         }
@@ -48,6 +52,8 @@ namespace pl::core::ast {
         std::unique_ptr<ASTNode> m_placementOffset, m_placementSection;
         bool m_constant;
 
+        [[nodiscard]] bool hasPerEntryAttributes() const;
+
         void createStaticArray(Evaluator *evaluator, std::shared_ptr<ptrn::Pattern> &resultPattern) const;
         void createDynamicArray(Evaluator *evaluator, std::shared_ptr<ptrn::Pattern> &resultPattern) const;
     };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <pl/core/ast/ast_node.hpp>
+#include <pl/core/attributes.hpp>
 
 namespace pl::core::ast {
 
@@ -18,6 +19,10 @@ namespace pl::core::ast {
             return this->m_attribute;
         }
 
+        [[nodiscard]] AttributeId getAttributeId() const {
+            return this->m_attributeId;
+        }
+
         [[nodiscard]] const std::vector<std::unique_ptr<ASTNode>> &getArguments() const {
             return this->m_value;
         }
@@ -32,6 +37,7 @@ namespace pl::core::ast {
 
     private:
         std::string m_attribute;
+        AttributeId m_attributeId;
         std::vector<std::unique_ptr<ASTNode>> m_value;
         std::string m_aliasNamespaceString, m_autoNamespace;
     };
@@ -15,9 +15,10 @@ namespace pl::core::ast {
         }
 
         [[nodiscard]] std::unique_ptr<ASTNode> evaluate(Evaluator *evaluator) const override;
+        [[nodiscard]] std::optional<Token::Literal> evaluateValue(Evaluator *evaluator) const override;
 
     private:
-        std::unique_ptr<ASTNode> castValue(const Token::Literal &literal, Token::ValueType type, const std::shared_ptr<ptrn::Pattern> &typePattern, Evaluator *evaluator) const;
+        Token::Literal castValue(const Token::Literal &literal, Token::ValueType type, const std::shared_ptr<ptrn::Pattern> &typePattern, Evaluator *evaluator) const;
 
     private:
         std::unique_ptr<ASTNode> m_value;
@@ -16,6 +16,14 @@ namespace pl::core::ast {
         void createPatterns(Evaluator *evaluator, std::vector<std::shared_ptr<ptrn::Pattern>> &resultPatterns) const override;
         FunctionResult execute(Evaluator *evaluator) const override;
 
+        [[nodiscard]] ControlFlowStatement getType() const {
+            return this->m_type;
+        }
+
+        [[nodiscard]] const std::unique_ptr<ASTNode> &getReturnValue() const {
+            return this->m_rvalue;
+        }
+
     private:
         ControlFlowStatement m_type;
         std::unique_ptr<ASTNode> m_rvalue;
@@ -31,7 +31,7 @@ namespace pl::core::ast {
             this->m_cachedEnumValues.clear();
         }
 
-        [[nodiscard]] const std::unique_ptr<ASTNode> &getUnderlyingType() { return this->m_underlyingType; }
+        [[nodiscard]] const std::unique_ptr<ASTNode> &getUnderlyingType() const { return this->m_underlyingType; }
 
     private:
         std::map<std::string, std::pair<std::unique_ptr<ASTNode>, std::unique_ptr<ASTNode>>> m_entries;
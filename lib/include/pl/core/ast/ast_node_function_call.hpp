@@ -2,6 +2,8 @@
 
 #include <pl/core/ast/ast_node.hpp>
 
+namespace pl::api { struct Function; }
+
 namespace pl::core::ast {
 
     class ASTNodeFunctionCall : public ASTNode {
@@ -24,11 +26,20 @@ namespace pl::core::ast {
 
         void createPatterns(Evaluator *evaluator, std::vector<std::shared_ptr<ptrn::Pattern>> &resultPatterns) const override;
         [[nodiscard]] std::unique_ptr<ASTNode> evaluate(Evaluator *evaluator) const override;
+        [[nodiscard]] std::optional<Token::Literal> evaluateValue(Evaluator *evaluator) const override;
+        FunctionResult callFunction(Evaluator *evaluator, std::vector<Token::Literal> &evaluatedParams) const;
         FunctionResult execute(Evaluator *evaluator) const override;
 
+    private:
+        [[nodiscard]] const api::Function &resolveFunction(Evaluator *evaluator) const;
+
     private:
         std::string m_functionName;
         std::vector<std::unique_ptr<ASTNode>> m_params;
+
+        // Function this call site got bound to, valid as long as the evaluator's function registry version matches
+        mutable const api::Function *m_function = nullptr;
+        mutable u64 m_functionRegistryVersion = 0;
     };
 
 }
\ No newline at end of file
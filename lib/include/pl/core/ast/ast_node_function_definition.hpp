@@ -1,6 +1,7 @@
 #pragma once
 
 #include <pl/core/ast/ast_node.hpp>
+#include <pl/core/vm.hpp>
 
 namespace pl::core::ast {
 
@@ -42,6 +43,9 @@ namespace pl::core::ast {
         std::vector<std::unique_ptr<ASTNode>> m_body;
         std::optional<std::string> m_parameterPack;
         std::vector<std::unique_ptr<ASTNode>> m_defaultParameters;
+
+        mutable std::unique_ptr<vm::Program> m_program;
+        mutable bool m_compiled = false;
     };
 
 }
\ No newline at end of file
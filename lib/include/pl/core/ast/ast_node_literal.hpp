@@ -13,6 +13,8 @@ namespace pl::core::ast {
             return std::unique_ptr<ASTNode>(new ASTNodeLiteral(*this));
         }
 
+        [[nodiscard]] std::optional<Token::Literal> evaluateValue(Evaluator *evaluator) const override;
+
         [[nodiscard]] const auto &getValue() const {
             return this->m_literal;
         }
@@ -90,6 +90,8 @@ namespace pl::core::ast {
         }
 
         [[nodiscard]] std::unique_ptr<ASTNode> evaluate(Evaluator *evaluator) const override;
+        [[nodiscard]] std::optional<Token::Literal> evaluateValue(Evaluator *evaluator) const override;
+        [[nodiscard]] Token::Literal evaluateOperator(Evaluator *evaluator, const Token::Literal &left, const Token::Literal &right) const;
 
         [[nodiscard]] const std::unique_ptr<ASTNode> &getLeftOperand() const { return this->m_left; }
         [[nodiscard]] const std::unique_ptr<ASTNode> &getRightOperand() const { return this->m_right; }
@@ -13,7 +13,7 @@ namespace pl::core::ast {
             return std::unique_ptr<ASTNode>(new ASTNodeMultiVariableDecl(*this));
         }
 
-        [[nodiscard]] const std::vector<std::shared_ptr<ASTNode>> &getVariables() {
+        [[nodiscard]] const std::vector<std::shared_ptr<ASTNode>> &getVariables() const {
             return this->m_variables;
         }
 
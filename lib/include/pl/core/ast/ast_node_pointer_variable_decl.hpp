@@ -4,6 +4,8 @@
 #include <pl/core/ast/ast_node_attribute.hpp>
 #include <pl/core/ast/ast_node_type_appilication.hpp>
 
+namespace pl::ptrn { class PatternPointer; struct PointeeTable; }
+
 namespace pl::core::ast {
 
     class ASTNodeTypeDecl;
@@ -30,6 +32,9 @@ namespace pl::core::ast {
         std::shared_ptr<ASTNode> m_type;
         std::shared_ptr<ASTNodeTypeApplication> m_sizeType;
         std::unique_ptr<ASTNode> m_placementOffset, m_placementSection;
+
+        [[nodiscard]] std::shared_ptr<ptrn::PointeeTable> getPointeeTable(Evaluator *evaluator, const std::shared_ptr<ptrn::PatternPointer> &pattern) const;
+        [[nodiscard]] bool canDeferPointee(Evaluator *evaluator, const ptrn::PointeeTable &table, u64 address) const;
     };
 
 }
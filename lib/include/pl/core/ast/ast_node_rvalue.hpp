@@ -21,6 +21,7 @@ namespace pl::core::ast {
         }
 
         [[nodiscard]] std::unique_ptr<ASTNode> evaluate(Evaluator *evaluator) const override;
+        [[nodiscard]] std::optional<Token::Literal> evaluateValue(Evaluator *evaluator) const override;
         void createPatterns(Evaluator *evaluator, std::vector<std::shared_ptr<ptrn::Pattern>> &resultPatterns) const override;
 
     private:
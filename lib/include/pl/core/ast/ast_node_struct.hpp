@@ -23,9 +23,26 @@ namespace pl::core::ast {
         [[nodiscard]] const std::vector<std::shared_ptr<ASTNode>> &getInheritance() const { return this->m_inheritance; }
         void addInheritance(std::shared_ptr<ASTNode> &&node) { this->m_inheritance.push_back(std::move(node)); }
 
+        /**
+         * @brief Checks if the layout of this struct can be determined without reading any data or running any code
+         * @note This is the case if the struct only consists of fixed size members that don't depend on their placement.
+         *       Arrays of such structs are represented by a single template entry instead of one pattern tree per entry
+         * @return True if every instance of this struct has the same layout
+         */
+        [[nodiscard]] bool hasStaticLayout() const;
+
+        /**
+         * @brief Checks if patterns of a type only depend on the address they're placed at
+         * @param type Type node to check
+         * @return True for built-in types and structs with a static layout as well as type declarations and enums of them
+         */
+        [[nodiscard]] static bool isStaticType(const ASTNode *type);
+
     private:
         std::vector<std::shared_ptr<ASTNode>> m_members;
         std::vector<std::shared_ptr<ASTNode>> m_inheritance;
+
+        mutable std::optional<bool> m_staticLayout;
     };
 
 }
\ No newline at end of file
@@ -14,12 +14,16 @@ namespace pl::core::ast {
         }
 
         [[nodiscard]] std::unique_ptr<ASTNode> evaluate(Evaluator *evaluator) const override;
+        [[nodiscard]] std::optional<Token::Literal> evaluateValue(Evaluator *evaluator) const override;
 
         [[nodiscard]] const std::unique_ptr<ASTNode> &getFirstOperand() const { return this->m_first; }
         [[nodiscard]] const std::unique_ptr<ASTNode> &getSecondOperand() const { return this->m_second; }
         [[nodiscard]] const std::unique_ptr<ASTNode> &getThirdOperand() const { return this->m_third; }
         [[nodiscard]] Token::Operator getOperator() const { return this->m_operator; }
 
+    private:
+        [[nodiscard]] bool evaluateCondition(Evaluator *evaluator) const;
+
     private:
         std::unique_ptr<ASTNode> m_first, m_second, m_third;
         Token::Operator m_operator;
@@ -19,6 +19,10 @@ namespace pl::core::ast {
             this->m_templateArguments = std::move(arguments);
         }
         
+        [[nodiscard]] const std::vector<std::unique_ptr<ASTNode>> &getTemplateArguments() const {
+            return this->m_templateArguments;
+        }
+
         std::vector<std::unique_ptr<ASTNode>> evaluateTemplateArguments(Evaluator *evaluator) const;
 
         [[nodiscard]] std::unique_ptr<ASTNode> evaluate(Evaluator *evaluator) const override;
@@ -22,6 +22,7 @@ namespace pl::core::ast {
         [[nodiscard]] const std::string &getName() const { return this->m_name; }
         [[nodiscard]] constexpr const std::shared_ptr<ASTNodeTypeApplication> &getType() const { return this->m_type; }
         [[nodiscard]] constexpr const std::unique_ptr<ASTNode> &getPlacementOffset() const { return this->m_placementOffset; }
+        [[nodiscard]] constexpr const std::unique_ptr<ASTNode> &getPlacementSection() const { return this->m_placementSection; }
 
         [[nodiscard]] constexpr bool isInVariable() const { return this->m_inVariable; }
         [[nodiscard]] constexpr bool isOutVariable() const { return this->m_outVariable; }
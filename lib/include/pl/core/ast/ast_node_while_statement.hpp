@@ -23,6 +23,10 @@ namespace pl::core::ast {
             return this->m_body;
         }
 
+        [[nodiscard]] const std::unique_ptr<ASTNode> &getPostExpression() const {
+            return this->m_postExpression;
+        }
+
         FunctionResult execute(Evaluator *evaluator) const override;
 
         [[nodiscard]] bool evaluateCondition(Evaluator *evaluator) const;
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <pl/helpers/types.hpp>
+
+namespace pl::core {
+
+    /**
+     * @brief Process-wide integer ID of an attribute name
+     */
+    using AttributeId = u32;
+
+    namespace attr {
+
+        constexpr static AttributeId Hidden             = 0;
+        constexpr static AttributeId HighlightHidden    = 1;
+        constexpr static AttributeId TreeHidden         = 2;
+        constexpr static AttributeId Sealed             = 3;
+        constexpr static AttributeId Inline             = 4;
+        constexpr static AttributeId Export             = 5;
+
+        /**
+         * @brief Number of built-in attributes that are tracked as bit flags on patterns
+         */
+        constexpr static AttributeId FlagCount          = 6;
+
+        [[nodiscard]] constexpr bool isFlag(AttributeId id) {
+            return id < FlagCount;
+        }
+
+    }
+
+    /**
+     * @brief Returns the ID of an attribute name, assigning a new one if the name hasn't been seen before
+     * @param name Attribute name
+     * @return Attribute ID
+     */
+    [[nodiscard]] AttributeId internAttribute(std::string_view name);
+
+    /**
+     * @brief Looks up the ID of an attribute name without assigning a new one
+     * @param name Attribute name
+     * @return Attribute ID or std::nullopt if the name has never been interned
+     */
+    [[nodiscard]] std::optional<AttributeId> findAttribute(std::string_view name);
+
+    /**
+     * @brief Returns the name of an interned attribute
+     * @param id Attribute ID
+     * @return Attribute name. The reference stays valid for the lifetime of the process
+     */
+    [[nodiscard]] const std::string& getAttributeName(AttributeId id);
+
+}
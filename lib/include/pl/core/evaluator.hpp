@@ -2,17 +2,25 @@
 
 #include <atomic>
 #include <bit>
+#include <deque>
 #include <list>
 #include <map>
+#include <memory_resource>
 #include <optional>
 #include <vector>
 #include <memory>
 #include <set>
+#include <span>
 #include <unordered_set>
 #include <unordered_map>
 
+#include <pl/core/attributes.hpp>
 #include <pl/core/log_console.hpp>
+#include <pl/helpers/bump_arena.hpp>
+#include <pl/helpers/small_buffer.hpp>
+#include <pl/helpers/string_interner.hpp>
 #include <pl/core/token.hpp>
+#include <pl/core/vm.hpp>
 #include <pl/api.hpp>
 
 #include <pl/core/errors/runtime_errors.hpp>
@@ -31,6 +39,7 @@ namespace pl::ptrn {
     class Pattern;
     class PatternCreationLimiter;
     class PatternBitfieldField;
+    struct PointeeTable;
 
 }
 
@@ -80,35 +89,209 @@ namespace pl::core {
             Scope(const std::shared_ptr<pl::ptrn::Pattern>& parentPattern,
                 std::vector<std::shared_ptr<pl::ptrn::Pattern>>* scopePatterns,
                 size_t heapSize,
-                bool clearScopeOnPop)
+                bool clearScopeOnPop,
+                const u64 *variableRenameCount = nullptr)
                 : parent(parentPattern),
                 scope(scopePatterns),
                 heapStartSize(heapSize),
-                clearOnPop(clearScopeOnPop) {}
+                clearOnPop(clearScopeOnPop),
+                renameCount(variableRenameCount) {}
+
+            /**
+             * @brief Finds the last variable in this scope with the given name
+             * @param name Name of the variable
+             * @return Pointer to the variable's slot in the scope or nullptr if it doesn't exist
+             */
+            [[nodiscard]] std::shared_ptr<ptrn::Pattern> *findVariable(const std::string &name);
 
             std::shared_ptr<ptrn::Pattern> parent;
             std::vector<std::shared_ptr<ptrn::Pattern>> *scope;
             std::optional<ParameterPack> parameterPack;
             size_t heapStartSize;
             bool clearOnPop;
+
+            // Name to slot lookup table, built lazily once the scope grows large enough
+            std::unordered_map<std::string, size_t> variableSlots;
+            size_t indexedVariableCount = 0;
+            const ptrn::Pattern *lastIndexedVariable = nullptr;
+            // Evaluator's variable rename count, a miss is only trusted if nothing got renamed since the table was built
+            const u64 *renameCount;
+            u64 indexedRenameCount = 0;
+        };
+
+        /**
+         * @brief State of the heap at a certain point in time, created by createHeapCheckpoint()
+         */
+        struct HeapCheckpoint {
+            size_t heapSize;
+            size_t previousWatermark;
+            size_t previousUndoLogStart;
+            u64 previousEpoch;
+        };
+
+        /**
+         * @brief State of the evaluator at a certain point in time, created by createCheckpoint()
+         */
+        struct Checkpoint {
+            ByteAndBitOffset readOffset;
+            size_t scopeCount;
+            size_t scopePatternCount;
+            size_t scopeHeapStartSize;
+            size_t heapSize;
+            size_t sectionIdStackSize;
+            size_t callStackSize;
+        };
+
+        /**
+         * @brief Storage of a single heap cell
+         * @note Cells get their memory from the heap arena, which is rewound whenever cells are removed from the end of the heap.
+         *       A cell that grows after other cells have been allocated can't stay in the arena and moves into its own allocation
+         */
+        class HeapCell {
+        public:
+            HeapCell(hlp::BumpArena &arena, size_t size);
+
+            [[nodiscard]] u8 *data() { return this->m_data; }
+            [[nodiscard]] const u8 *data() const { return this->m_data; }
+            [[nodiscard]] size_t size() const { return this->m_size; }
+            [[nodiscard]] bool empty() const { return this->m_size == 0; }
+
+            [[nodiscard]] u8 *begin() { return this->m_data; }
+            [[nodiscard]] u8 *end() { return this->m_data + this->m_size; }
+            [[nodiscard]] const u8 *begin() const { return this->m_data; }
+            [[nodiscard]] const u8 *end() const { return this->m_data + this->m_size; }
+
+            /**
+             * @brief Resizes the cell, new bytes are zero-initialized
+             * @param size New size in bytes
+             */
+            void resize(size_t size);
+
+            /**
+             * @brief Replaces the contents of the cell
+             * @param data New contents
+             */
+            void assign(std::span<const u8> data);
+
+            /**
+             * @brief Position of the arena before this cell was allocated, rewinding to it frees this cell and all cells after it
+             */
+            [[nodiscard]] const hlp::BumpArena::Marker &getArenaMarker() const { return this->m_arenaMarker; }
+
+            /**
+             * @brief Heap checkpoint epoch in which the contents of this cell were last backed up
+             */
+            [[nodiscard]] u64 getBackupEpoch() const { return this->m_backupEpoch; }
+            void setBackupEpoch(u64 epoch) { this->m_backupEpoch = epoch; }
+
+        private:
+            hlp::BumpArena *m_arena;
+            hlp::BumpArena::Marker m_arenaMarker;
+            u8 *m_data;
+            size_t m_size;
+            size_t m_capacity;
+            std::unique_ptr<u8[]> m_ownedData;
+            u64 m_backupEpoch = 0;
         };
 
         struct PatternLocalData {
+            // Most pattern locals are single scalars, these fit into the cell itself without allocating
+            using Buffer = hlp::SmallBuffer<u8, 16>;
+
             u32 referenceCount;
-            std::vector<u8> data;
+            Buffer data;
+        };
+
+        /**
+         * @brief Storage for pattern local variables
+         * @note Cells are addressed by dense indices. Freed cells keep their buffers and get handed out again by allocate()
+         */
+        class PatternLocalStorage {
+        public:
+            /**
+             * @brief Creates a new zero-initialized cell without any references
+             * @param size Size of the cell in bytes
+             * @return Address of the new cell
+             */
+            [[nodiscard]] u32 allocate(size_t size);
+
+            /**
+             * @brief Gets the cell at the given address, creating it if it doesn't exist yet
+             * @param address Address of the cell
+             * @return Cell data
+             */
+            [[nodiscard]] PatternLocalData &getOrCreate(u32 address);
+
+            /**
+             * @brief Finds the cell at the given address
+             * @param address Address of the cell
+             * @return Cell data or nullptr if there is no such cell
+             */
+            [[nodiscard]] PatternLocalData *find(u32 address) {
+                if (address >= this->m_cells.size() || !this->m_cells[address].used)
+                    return nullptr;
+
+                return &this->m_cells[address].data;
+            }
+
+            /**
+             * @brief Frees the cell at the given address
+             * @param address Address of the cell
+             */
+            void release(u32 address);
+
+            void clear() {
+                this->m_cells.clear();
+                this->m_freeCells.clear();
+            }
+
+        private:
+            struct Cell {
+                PatternLocalData data;
+                bool used;
+            };
+
+            std::vector<Cell> m_cells;
+            std::vector<u32> m_freeCells;
         };
 
         struct UpdateHandler {
-            UpdateHandler(Evaluator *evaluator, const ast::ASTNode *node);
-            ~UpdateHandler();
+            UpdateHandler(Evaluator *evaluator, const ast::ASTNode *node) : evaluator(evaluator) {
+                if (evaluator->m_evaluationMode == EvaluationMode::Release) {
+                    if (evaluator->m_evaluated)
+                        return;
+
+                    // Aborting only needs to be noticed eventually, don't poll the atomic for every single node
+                    if ((++evaluator->m_abortPollCounter & (AbortPollInterval - 1)) == 0) [[unlikely]]
+                        evaluator->handleAbort();
+
+                    this->node = node;
+                    this->offset = evaluator->m_currOffset;
+                } else {
+                    this->enter(node);
+                }
+            }
+
+            ~UpdateHandler() {
+                if (std::uncaught_exceptions() > 0) [[unlikely]]
+                    this->unwind();
+            }
 
             Evaluator *evaluator;
             const ast::ASTNode *node = nullptr;
             u64 offset = 0;
+
+        private:
+            constexpr static u32 AbortPollInterval = 64;
+
+            void enter(const ast::ASTNode *node);
+            void unwind();
         };
 
+        // Refers to the evaluated AST instead of copying it, the node is only valid as long as that AST is alive
         struct StackTrace {
-            std::unique_ptr<ast::ASTNode> node;
+            Location location;
+            const ast::ASTNode *node;
             u64 cursorAddress;
         };
 
@@ -264,9 +447,32 @@ namespace pl::core {
         }
 
         [[nodiscard]] u64 getPatternCount() const {
-            return this->m_currPatternCount;
+            return *this->m_patternCounter;
         }
 
+        void setPatternArenaEnabled(bool enabled) {
+            this->m_patternArenaEnabled = enabled;
+        }
+
+        [[nodiscard]] bool isPatternArenaEnabled() const {
+            return this->m_patternArenaEnabled;
+        }
+
+        /**
+         * @brief Returns the memory resource patterns of the current run are allocated from
+         * @return Arena of the current run or nullptr if patterns are allocated individually
+         */
+        [[nodiscard]] const std::shared_ptr<std::pmr::memory_resource>& getPatternArena() const {
+            return this->m_patternArena;
+        }
+
+        /**
+         * @brief Drops all patterns of the last run at once
+         * @note Bookkeeping of patterns destroyed during the release is skipped and cleared in bulk instead
+         * @param release Function releasing the remaining external references to the patterns
+         */
+        void releasePatterns(const std::function<void()> &release = { });
+
         void setLoopLimit(u64 limit) {
             this->m_loopLimit = limit;
         }
@@ -303,8 +509,8 @@ namespace pl::core {
         [[nodiscard]] u128 readBits(u128 byteOffset, u8 bitOffset, u64 bitSize, u64 section, std::endian endianness);
         void writeBits(u128 byteOffset, u8 bitOffset, u64 bitSize, u64 section, std::endian endianness, u128 value);
 
-        bool addBuiltinFunction(const std::string &name, api::FunctionParameterCount numParams, std::vector<Token::Literal> defaultParameters, const api::FunctionCallback &function, bool dangerous);
-        bool addCustomFunction(const std::string &name, api::FunctionParameterCount numParams, std::vector<Token::Literal> defaultParameters, const api::FunctionCallback &function);
+        bool addBuiltinFunction(const std::string &name, api::FunctionParameterCount numParams, std::vector<Token::Literal> defaultParameters, const api::FunctionSpanCallback &function, bool dangerous);
+        bool addCustomFunction(const std::string &name, api::FunctionParameterCount numParams, std::vector<Token::Literal> defaultParameters, const api::FunctionSpanCallback &function);
 
         [[nodiscard]] const std::unordered_map<std::string, api::Function> &getBuiltinFunctions() const {
             return this->m_builtinFunctions;
@@ -315,20 +521,114 @@ namespace pl::core {
         }
 
         [[nodiscard]] std::optional<api::Function> findFunction(const std::string &name) const;
+        [[nodiscard]] const api::Function *getFunction(const std::string &name) const;
 
-        [[nodiscard]] std::vector<std::vector<u8>> &getHeap() {
+        // Changes every time a function gets added or removed. Function pointers obtained
+        // through getFunction() stay valid as long as this value doesn't change
+        [[nodiscard]] u64 getFunctionRegistryVersion() const {
+            return this->m_functionRegistryVersion;
+        }
+
+        // Has to be called whenever an existing variable gets a different name, e.g. when it's passed to a
+        // function by reference. Scopes can't find a variable under its new name in their lookup tables otherwise
+        void variableRenamed() {
+            this->m_variableRenameCount += 1;
+        }
+
+        // Argument buffers for function calls, one per call depth. Their storage is reused
+        // so passing parameters to a function doesn't allocate once the buffers have grown
+        [[nodiscard]] std::vector<Token::Literal> &pushArgumentFrame();
+        void popArgumentFrame();
+
+        [[nodiscard]] std::vector<HeapCell> &getHeap() {
             return this->m_heap;
         }
 
-        [[nodiscard]] const std::vector<std::vector<u8>> &getHeap() const {
+        [[nodiscard]] const std::vector<HeapCell> &getHeap() const {
             return this->m_heap;
         }
 
-        [[nodiscard]] std::map<u32, PatternLocalData> &getPatternLocalStorage() {
+        /**
+         * @brief Appends a new zero-initialized cell to the heap
+         * @note The cell is allocated from the heap arena, leaving the scope it was created in hands the memory back all at once
+         * @param size Size of the cell in bytes
+         * @return Heap address of the new cell
+         */
+        [[nodiscard]] u64 allocateHeapCell(size_t size);
+
+        /**
+         * @brief Marks the current state of the heap so it can be rolled back later on
+         * @note Cells that exist at this point are only copied once they get modified. Checkpoints need to be restored in reverse order of creation
+         * @return Checkpoint to pass to restoreHeapCheckpoint()
+         */
+        [[nodiscard]] HeapCheckpoint createHeapCheckpoint();
+
+        /**
+         * @brief Rolls the heap back to the state it was in when the checkpoint was created
+         * @param checkpoint Checkpoint returned by createHeapCheckpoint()
+         */
+        void restoreHeapCheckpoint(const HeapCheckpoint &checkpoint);
+
+        /**
+         * @brief Marks the current cursor, scope, heap and section state so a failed evaluation can be undone
+         * @note Unlike heap checkpoints, modifications of existing heap cells are kept when restoring
+         * @return Checkpoint to pass to restoreCheckpoint()
+         */
+        [[nodiscard]] Checkpoint createCheckpoint() const;
+
+        /**
+         * @brief Discards everything that was created since the checkpoint and moves the cursor back
+         * @param checkpoint Checkpoint returned by createCheckpoint()
+         */
+        void restoreCheckpoint(const Checkpoint &checkpoint);
+
+        /**
+         * @brief Runs a callback and rolls the evaluator back if it fails with an evaluation error
+         * @param callback Callback to evaluate
+         * @return True if the callback succeeded, false if it got rolled back
+         */
+        bool speculate(const std::function<void()> &callback);
+
+        /**
+         * @brief Creates a new instance of a type with a static layout at the current cursor position
+         * @note Only returns a pattern if an instance of the type has been cached before using cacheTypeLayout()
+         * @param type Type node the layout was cached for
+         * @return Copy of the cached layout rebased to the current offset or nullptr if none is available
+         */
+        [[nodiscard]] std::shared_ptr<ptrn::Pattern> instantiateCachedTypeLayout(const ast::ASTNode *type);
+
+        /**
+         * @brief Remembers the layout of a freshly created type with a static layout for later instantiations
+         * @param type Type node the pattern was created from
+         * @param pattern Pattern created by the type
+         */
+        void cacheTypeLayout(const ast::ASTNode *type, const std::shared_ptr<ptrn::Pattern> &pattern);
+
+        /**
+         * @brief Returns the table of pointees shared by all pointers to a type with a static layout
+         * @param type Type node of the pointee
+         * @return Table of the type in the current section or nullptr if pointees can't be shared right now
+         */
+        [[nodiscard]] std::shared_ptr<ptrn::PointeeTable> getPointeeTable(const ast::ASTNode *type);
+
+        /**
+         * @brief Sets if pointees of all pointers are only created once they're accessed
+         * @note Pointers can also opt into this individually using the [[lazy]] attribute
+         * @param enabled True to defer creating pointees
+         */
+        void setLazyPointers(bool enabled) {
+            this->m_lazyPointers = enabled;
+        }
+
+        [[nodiscard]] bool areLazyPointersEnabled() const {
+            return this->m_lazyPointers;
+        }
+
+        [[nodiscard]] PatternLocalStorage &getPatternLocalStorage() {
             return this->m_patternLocalStorage;
         }
 
-        [[nodiscard]] const std::map<u32, PatternLocalData> &getPatternLocalStorage() const {
+        [[nodiscard]] const PatternLocalStorage &getPatternLocalStorage() const {
             return this->m_patternLocalStorage;
         }
 
@@ -418,11 +718,52 @@ namespace pl::core {
             return this->m_debugMode;
         }
 
+        void setExecutionEngine(ExecutionEngine engine) {
+            this->m_executionEngine = engine;
+        }
+
+        /**
+         * @brief Sets the evaluation mode
+         * @note In release mode breakpoints are ignored and abort requests are only polled every few nodes
+         * @param mode Evaluation mode
+         */
+        void setEvaluationMode(EvaluationMode mode) {
+            this->m_evaluationMode = mode;
+        }
+
+        [[nodiscard]] EvaluationMode getEvaluationMode() const {
+            return this->m_evaluationMode;
+        }
+
+        /**
+         * @brief Sets the number of threads used to evaluate independent top-level placements
+         * @note Only used in release mode. Placements of plain data types at constant addresses don't depend on each other,
+         *       consecutive ones are split up between worker evaluators. The data source needs to support concurrent reads
+         * @param count Number of threads. 1 evaluates everything on the calling thread
+         */
+        void setWorkerCount(u32 count) {
+            this->m_workerCount = count;
+        }
+
+        [[nodiscard]] u32 getWorkerCount() const {
+            return this->m_workerCount;
+        }
+
+        [[nodiscard]] ExecutionEngine getExecutionEngine() const {
+            return this->m_executionEngine;
+        }
+
+        [[nodiscard]] vm::VirtualMachine &getVirtualMachine() {
+            return this->m_virtualMachine;
+        }
+
         void allowMainSectionEdits() {
             this->m_mainSectionEditsAllowed = true;
         }
 
-        [[nodiscard]] Evaluator::UpdateHandler updateRuntime(const ast::ASTNode *node);
+        [[nodiscard]] Evaluator::UpdateHandler updateRuntime(const ast::ASTNode *node) {
+            return { this, node };
+        }
 
         void addBreakpoint(u32 line);
         void removeBreakpoint(u32 line);
@@ -445,18 +786,14 @@ namespace pl::core {
             return this->m_lastPatternAddress;
         }
 
-        std::set<std::string>& getStringPool() {
+        hlp::StringInterner& getStringPool() {
             return this->m_stringPool;
         }
 
-        const std::set<std::string>& getStringPool() const {
+        const hlp::StringInterner& getStringPool() const {
             return this->m_stringPool;
         }
 
-        bool isStringPoolEntryValid(const std::set<std::string>::const_iterator &it) const {
-            return it != this->m_stringPool.end();
-        }
-
         PatternLanguage& createSubRuntime() {
             return m_subRuntimes.emplace_back(this->m_patternLanguage->cloneRuntime());
         }
@@ -478,8 +815,8 @@ namespace pl::core {
         }
 
         const std::set<ptrn::Pattern*>& getPatternsWithAttribute(const std::string &attribute) const {
-            if (const auto it = m_attributedPatterns.find(attribute); it != m_attributedPatterns.end()) {
-                return it->second;
+            if (const auto id = findAttribute(attribute); id.has_value() && *id < m_attributedPatterns.size()) {
+                return m_attributedPatterns[*id];
             } else {
                 static const std::set<ptrn::Pattern*> empty;
                 return empty;
@@ -490,20 +827,34 @@ namespace pl::core {
         void patternCreated(ptrn::Pattern *pattern);
         void patternDestroyed(ptrn::Pattern *pattern);
 
-        api::FunctionCallback handleDangerousFunctionCall(const std::string &functionName, const api::FunctionCallback &function);
+        [[nodiscard]] bool canUseTypeLayoutCache() const;
+        void registerTypeLayoutInstance(ptrn::Pattern *pattern);
+
+        [[nodiscard]] bool canEvaluatePlacementsConcurrently() const;
+        void evaluatePlacementsConcurrently(std::span<ast::ASTNode* const> nodes);
+        void evaluatePlacements(const Evaluator &parent, std::span<ast::ASTNode* const> nodes, std::vector<std::shared_ptr<ptrn::Pattern>> &patterns);
+
+        void backupHeapCell(size_t index);
+        void releaseHeapCells(size_t minSize);
+        void truncateHeap(size_t size);
+
+        api::FunctionSpanCallback handleDangerousFunctionCall(const std::string &functionName, const api::FunctionSpanCallback &function);
 
         void setRuntime(PatternLanguage *runtime) {
             this->m_patternLanguage = runtime;
         }
 
 
-        void addAttributedPattern(const std::string &attribute, ptrn::Pattern *pattern) {
+        void addAttributedPattern(AttributeId attribute, ptrn::Pattern *pattern) {
+            if (attribute >= m_attributedPatterns.size())
+                m_attributedPatterns.resize(attribute + 1);
+
             m_attributedPatterns[attribute].insert(pattern);
         }
 
-        void removeAttributedPattern(const std::string &attribute, ptrn::Pattern *pattern) {
-            if (const auto it = m_attributedPatterns.find(attribute); it != m_attributedPatterns.end())
-                it->second.erase(pattern);
+        void removeAttributedPattern(AttributeId attribute, ptrn::Pattern *pattern) {
+            if (attribute < m_attributedPatterns.size())
+                m_attributedPatterns[attribute].erase(pattern);
         }
 
     private:
@@ -517,6 +868,14 @@ namespace pl::core {
 
         bool m_evaluated = false;
         bool m_debugMode = false;
+        bool m_lazyPointers = false;
+        ExecutionEngine m_executionEngine = ExecutionEngine::AST;
+        EvaluationMode m_evaluationMode = EvaluationMode::Debuggable;
+        u32 m_workerCount = 1;
+        // Evaluators used to evaluate placements concurrently. Kept around since their patterns refer to them
+        std::vector<std::unique_ptr<Evaluator>> m_workers;
+        u32 m_abortPollCounter = 0;
+        vm::VirtualMachine m_virtualMachine;
         LogConsole m_console;
 
         std::endian m_defaultEndian = std::endian::native;
@@ -526,6 +885,11 @@ namespace pl::core {
         u64 m_loopLimit = 0;
 
         std::atomic<u64> m_currPatternCount = 0;
+        // Counter patterns are counted in. Workers count into the one of the evaluator they evaluate placements for
+        std::atomic<u64> *m_patternCounter = &m_currPatternCount;
+        bool m_patternArenaEnabled = false;
+        bool m_releasingPatterns = false;
+        std::shared_ptr<std::pmr::memory_resource> m_patternArena;
 
         std::atomic<bool> m_aborted;
 
@@ -533,16 +897,47 @@ namespace pl::core {
         std::map<u64, api::Section> m_sections;
         u64 m_sectionId = 0;
 
-        std::vector<std::vector<u8>> m_heap;
-        std::map<u32, u32> m_heapReferenceCounts;
-        std::map<u32, PatternLocalData> m_patternLocalStorage;
+        hlp::BumpArena m_heapArena;
+        std::vector<HeapCell> m_heap;
+
+        // Original contents of heap cells below the watermark that were modified since the innermost checkpoint was created
+        struct HeapUndoEntry {
+            size_t index;
+            u64 previousEpoch;
+            std::vector<u8> data;
+        };
+        std::vector<HeapUndoEntry> m_heapUndoLog;
+        size_t m_heapUndoLogStart = 0;
+        size_t m_heapWatermark = 0;
+        // Every heap checkpoint gets its own epoch, cells tagged with the current one are already in the undo log
+        u64 m_heapEpoch = 0;
+        u64 m_heapEpochCount = 0;
+        // Number of patterns referencing each heap cell, indexed by heap address
+        std::vector<u32> m_heapReferenceCounts;
+        PatternLocalStorage m_patternLocalStorage;
+
+        struct TypeLayoutKey {
+            const ast::ASTNode *type;
+            std::endian endian;
+            u64 section;
+
+            auto operator<=>(const TypeLayoutKey &) const = default;
+        };
+
+        // Prototypes of types with a static layout, cloned and rebased for every further instance
+        std::map<TypeLayoutKey, std::shared_ptr<ptrn::Pattern>> m_typeLayoutCache;
+        std::map<TypeLayoutKey, std::shared_ptr<ptrn::PointeeTable>> m_pointeeTables;
 
-        std::map<std::string, std::set<ptrn::Pattern*>> m_attributedPatterns;
+        std::vector<std::set<ptrn::Pattern*>> m_attributedPatterns;
         std::vector<std::unique_ptr<Scope>> m_scopes;
         std::vector<std::shared_ptr<ptrn::Pattern>> m_patterns;
 
         std::unordered_map <std::string, api::Function> m_customFunctions;
         std::unordered_map <std::string, api::Function> m_builtinFunctions;
+        u64 m_functionRegistryVersion = 0;
+        u64 m_variableRenameCount = 0;
+        std::deque<std::vector<Token::Literal>> m_argumentFrames;
+        size_t m_argumentFrameDepth = 0;
         std::vector<std::unique_ptr<ast::ASTNode>> m_customFunctionDefinitions;
 
         std::optional<Token::Literal> m_mainResult;
@@ -561,7 +956,7 @@ namespace pl::core {
         ControlFlowStatement m_currControlFlowStatement = ControlFlowStatement::None;
         std::vector<StackTrace> m_callStack;
 
-        std::set<std::string> m_stringPool;
+        hlp::StringInterner m_stringPool;
 
         u64 m_dataBaseAddress = 0x00;
         u64 m_dataSize = 0x00;
@@ -571,6 +966,9 @@ namespace pl::core {
         std::function<void(u64, const u8*, size_t)> m_writerFunction = [](u64, const u8*, size_t){
             err::E0011.throwError("No memory has been attached. Writing is disabled.");
         };
+        // Functions passed to setDataSource(), shared with worker evaluators
+        std::function<void(u64, u8*, size_t)> m_dataSourceReader;
+        std::optional<std::function<void(u64, const u8*, size_t)>> m_dataSourceWriter;
 
         bool m_mainSectionEditsAllowed = false;
 
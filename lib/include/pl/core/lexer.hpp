@@ -4,6 +4,7 @@
 #include <pl/core/errors/error.hpp>
 
 #include <pl/core/token.hpp>
+#include <pl/core/token_cache.hpp>
 
 #include <fmt/format.h>
 
@@ -23,6 +24,12 @@ namespace pl::core {
         size_t getLongestLineLength() const { return m_longestLineLength; }
         void reset();
 
+        /**
+         * @brief Sets the cache used to store the tokens of included sources between runs
+         * @param cache Cache to use or std::nullopt to always lex sources
+         */
+        void setTokenCache(std::optional<TokenCache> cache) { m_tokenCache = std::move(cache); }
+
     private:
         [[nodiscard]] char peek(size_t p = 1) const;
         bool processToken(auto parserFunction, const std::string_view& identifier);
@@ -35,11 +42,8 @@ namespace pl::core {
         std::optional<Token> parseOneLineDocComment();
         std::optional<Token> parseMultiLineComment();
         std::optional<Token> parseMultiLineDocComment();
-        std::optional<Token> parseKeyword(const std::string_view &identifier);
-        std::optional<Token> parseType(const std::string_view &identifier);
+        std::optional<Token> parseWord(const std::string_view &identifier);
         std::optional<Token> parseDirectiveName(const std::string_view &identifier);
-        std::optional<Token> parseNamedOperator(const std::string_view &identifier);
-        std::optional<Token> parseConstant(const std::string_view &identifier);
         std::optional<Token> parseStringLiteral();
         std::optional<Token> parseDirectiveArgument();
         std::optional<Token> parseDirectiveValue();
@@ -60,7 +64,7 @@ namespace pl::core {
             }
             return false;
         }
-        std::string m_sourceCode;
+        std::string_view m_sourceCode;
         const api::Source* m_source = nullptr;
         std::vector<Token> m_tokens;
         size_t m_cursor = 0;
@@ -68,5 +72,6 @@ namespace pl::core {
         u32 m_lineBegin = 0;
         size_t m_longestLineLength = 0;
         u32 m_errorLength = 0;
+        std::optional<TokenCache> m_tokenCache;
     };
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <pl/core/errors/error.hpp>
 
 #include <pl/core/parser_manager.hpp>
+#include <pl/core/type_table.hpp>
 
 #include <pl/core/ast/ast_node.hpp>
 #include <pl/core/ast/ast_node_rvalue.hpp>
@@ -56,10 +57,10 @@ namespace pl::core {
         TokenIter m_startToken, m_originalPosition, m_partOriginalPosition;
 
         std::vector<hlp::safe_shared_ptr<ast::ASTNodeTypeDecl>> m_currTemplateType;
-        std::map<std::string, hlp::safe_shared_ptr<ast::ASTNodeTypeDecl>> m_types;
+        TypeTable m_types;
 
         std::vector<TokenIter> m_matchedOptionals;
-        std::vector<std::vector<std::string>> m_currNamespace;
+        std::vector<std::vector<TypeTable::Scope>> m_currNamespace;
 
         std::vector<std::string> m_globalDocComments;
         i32 m_ignoreDocsCount = 0;
@@ -121,18 +122,13 @@ namespace pl::core {
             return fmt::format("{} ({})", this->m_curr[index].getFormattedType(), this->m_curr[index].getFormattedValue());
         }
 
-        [[nodiscard]] std::vector<std::string> getNamespacePrefixedNames(const std::string &name) const {
-            std::vector<std::string> result;
-
-            result.push_back(name);
-
-            std::string namespacePrefix;
-            for (const auto &part : this->m_currNamespace.back()) {
-                namespacePrefix += fmt::format("{}::", part);
-                result.push_back(fmt::format("{}{}", namespacePrefix, name));
-            }
+        [[nodiscard]] TypeTable::Scope getCurrentScope() const {
+            const auto &scopes = this->m_currNamespace.back();
+            return scopes.empty() ? TypeTable::GlobalScope : scopes.back();
+        }
 
-            return result;
+        [[nodiscard]] TypeTable::Type* resolveType(std::string_view name) {
+            return this->m_types.resolve(this->m_currNamespace.back(), name);
         }
 
         void next() {
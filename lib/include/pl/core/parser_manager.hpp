@@ -3,6 +3,7 @@
 #include <pl/api.hpp>
 #include <pl/core/ast/ast_node.hpp>
 #include <pl/core/ast/ast_node_type_decl.hpp>
+#include <pl/core/type_table.hpp>
 #include <pl/helpers/safe_pointer.hpp>
 
 #include <pl/core/errors/result.hpp>
@@ -17,7 +18,7 @@ namespace pl::core {
 
         struct ParsedData {
             std::vector<std::shared_ptr<ast::ASTNode>> astNodes;
-            std::map<std::string, hlp::safe_shared_ptr<ast::ASTNodeTypeDecl>> types;
+            TypeTable types;
         };
 
         hlp::CompileResult<ParsedData> parse(api::Source* source, const std::string &namespacePrefix = "");
@@ -71,7 +72,7 @@ namespace pl::core {
         }
 
 private:
-        std::map<OnceIncludePair, std::map<std::string, hlp::safe_shared_ptr<ast::ASTNodeTypeDecl>>> m_parsedTypes;
+        std::map<OnceIncludePair, TypeTable> m_parsedTypes;
         std::map<std::string, hlp::safe_shared_ptr<ast::ASTNodeTypeDecl>> m_builtinTypes;
         std::set<OnceIncludePair> m_onceIncluded {};
         std::set<OnceIncludePair> m_preprocessorOnceIncluded {};
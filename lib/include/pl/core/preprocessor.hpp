@@ -110,11 +110,16 @@ namespace pl::core {
             return m_namespaces;
         }
 
+        [[nodiscard]] const auto &getPragmas() const {
+            return m_pragmas;
+        }
+
         const auto &getOnceIncludedFiles() const {
             return m_onceIncludedFiles;
         }
 
         void appendToNamespaces(std::vector<Token> tokens);
+        void appendToPragmas(const Preprocessor &other);
         void saveTokens(api::Source *source, const std::vector<Token> &tokens);
         const std::map<std::string, std::vector<Token>> &getParsedImports() const {
             return m_parsedImports;
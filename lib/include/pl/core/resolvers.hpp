@@ -3,6 +3,9 @@
 #include <pl/core/resolver.hpp>
 #include <wolv/io/fs.hpp>
 
+#include <map>
+#include <memory>
+
 namespace pl::core::resolvers {
 
     using Result = hlp::Result<api::Source, std::string>;
@@ -29,7 +32,18 @@ namespace pl::core::resolvers {
         }
 
     private:
+        struct CachedFile {
+            std::fs::file_time_type lastWriteTime;
+            std::uintmax_t size;
+            std::shared_ptr<const std::string> content;
+        };
+
+        [[nodiscard]] std::shared_ptr<const std::string> readFile(const std::fs::path &path) const;
+
         mutable std::vector<std::fs::path> m_includePaths;
         mutable std::map<std::string, api::Source> m_virtualFiles;
+
+        // Contents of files read from the include paths, keyed by their canonical path
+        mutable std::map<std::fs::path, CachedFile> m_fileCache;
     };
 }
\ No newline at end of file
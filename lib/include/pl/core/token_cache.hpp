@@ -0,0 +1,50 @@
+#pragma once
+
+#include <pl/api.hpp>
+#include <pl/core/token.hpp>
+
+#include <wolv/io/fs.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace pl::core {
+
+    /**
+     * @brief On-disk cache of the tokens of included sources
+     * @note Entries are keyed by a hash of the source content, so an edited source never reuses stale tokens
+     */
+    class TokenCache {
+    public:
+        struct Entry {
+            std::vector<Token> tokens;
+            size_t longestLineLength;
+        };
+
+        explicit TokenCache(std::fs::path directory) : m_directory(std::move(directory)) { }
+
+        /**
+         * @brief Loads the tokens of a source that were stored by an earlier run
+         * @param source Source to load the tokens for. All loaded locations refer to this source
+         * @return Cached entry or std::nullopt if there is no valid entry for the source content
+         */
+        [[nodiscard]] std::optional<Entry> load(const api::Source *source) const;
+
+        /**
+         * @brief Stores the tokens of a source so later runs can skip lexing it
+         * @param source Source the tokens were created from
+         * @param entry Tokens and longest line length of the source
+         */
+        void store(const api::Source *source, const Entry &entry) const;
+
+        [[nodiscard]] const std::fs::path& getDirectory() const {
+            return this->m_directory;
+        }
+
+    private:
+        [[nodiscard]] std::fs::path getEntryPath(const api::Source *source) const;
+
+        std::fs::path m_directory;
+    };
+
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <pl/helpers/types.hpp>
+#include <pl/helpers/safe_pointer.hpp>
+#include <pl/helpers/string_interner.hpp>
+
+#include <pl/core/ast/ast_node_type_decl.hpp>
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace pl::core {
+
+    /**
+     * @brief Table of the types known to the parser, keyed by interned qualified names
+     * @note Qualified names form a tree of scopes where every scope is one name segment inside its parent.
+     *       Resolving a name from inside a namespace walks that tree instead of building prefixed names
+     */
+    class TypeTable {
+    public:
+        using Type = hlp::safe_shared_ptr<ast::ASTNodeTypeDecl>;
+        using Entry = std::pair<std::string, Type>;
+        using Scope = u32;
+
+        constexpr static Scope GlobalScope = 0;
+        constexpr static Scope InvalidScope = ~Scope(0);
+
+        TypeTable() { this->clear(); }
+
+        /**
+         * @brief Returns the scope of a name relative to a parent scope, creating it if it doesn't exist yet
+         * @param parent Scope the name is relative to
+         * @param name Name of the scope, may be qualified
+         * @return Scope of the name
+         */
+        [[nodiscard]] Scope getScope(Scope parent, std::string_view name);
+
+        /**
+         * @brief Looks up the scope of a name relative to a parent scope without creating it
+         * @param parent Scope the name is relative to
+         * @param name Name of the scope, may be qualified
+         * @return Scope of the name or InvalidScope if no such scope exists
+         */
+        [[nodiscard]] Scope findScope(Scope parent, std::string_view name) const;
+
+        /**
+         * @brief Builds the fully qualified name of a name inside a scope
+         * @param scope Scope the name is declared in
+         * @param name Name to qualify
+         * @return Qualified name, e.g. "a::b::name"
+         */
+        [[nodiscard]] std::string getQualifiedName(Scope scope, std::string_view name = "") const;
+
+        /**
+         * @brief Looks up a type relative to a scope
+         * @param scope Scope the name is relative to
+         * @param name Name of the type, may be qualified
+         * @return Type or nullptr if there's no such type
+         */
+        [[nodiscard]] Type* find(Scope scope, std::string_view name);
+        [[nodiscard]] Type* find(std::string_view qualifiedName) { return this->find(GlobalScope, qualifiedName); }
+
+        /**
+         * @brief Resolves a type the way it's looked up from inside nested namespaces
+         * @note The global scope is tried first, followed by every scope of the chain from the outermost to the innermost one
+         * @param scopeChain Namespaces the lookup happens in, outermost first
+         * @param name Name of the type, may be qualified
+         * @return Type or nullptr if there's no such type in any of the scopes
+         */
+        [[nodiscard]] Type* resolve(std::span<const Scope> scopeChain, std::string_view name);
+
+        /**
+         * @brief Adds a type unless a type with the same name already exists
+         * @return True if the type was added
+         */
+        bool emplace(Scope scope, std::string_view name, Type type);
+        bool emplace(std::string_view qualifiedName, Type type) { return this->emplace(GlobalScope, qualifiedName, std::move(type)); }
+
+        /**
+         * @brief Adds a type, replacing any existing type with the same name
+         */
+        void set(std::string_view qualifiedName, Type type);
+
+        void clear();
+
+        [[nodiscard]] auto begin() { return this->m_entries.begin(); }
+        [[nodiscard]] auto end() { return this->m_entries.end(); }
+        [[nodiscard]] auto begin() const { return this->m_entries.begin(); }
+        [[nodiscard]] auto end() const { return this->m_entries.end(); }
+        [[nodiscard]] size_t size() const { return this->m_entries.size(); }
+        [[nodiscard]] bool empty() const { return this->m_entries.empty(); }
+
+    private:
+        constexpr static u32 NoEntry = ~u32(0);
+
+        struct ScopeInfo {
+            Scope parent;
+            hlp::StringInterner::Handle segment;
+            u32 entry;
+        };
+
+        [[nodiscard]] static u64 getChildKey(Scope parent, hlp::StringInterner::Handle segment) {
+            return (u64(parent) << 32) | segment;
+        }
+
+        Entry& getEntry(Scope scope);
+
+        hlp::StringInterner m_segments;
+        std::unordered_map<u64, Scope> m_children;
+        std::vector<ScopeInfo> m_scopes;
+        std::vector<Entry> m_entries;
+    };
+
+}
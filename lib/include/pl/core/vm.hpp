@@ -0,0 +1,95 @@
+#pragma once
+
+#include <pl/core/token.hpp>
+#include <pl/helpers/types.hpp>
+
+#include <deque>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace pl::core {
+    class Evaluator;
+
+    enum class ExecutionEngine {
+        AST,
+        Bytecode
+    };
+
+    enum class EvaluationMode {
+        Debuggable,
+        Release
+    };
+
+    namespace ast {
+        class ASTNode;
+        class ASTNodeFunctionDefinition;
+    }
+}
+
+namespace pl::core::vm {
+
+    enum class Opcode : u8 {
+        LoadConstant,           // dst = constants[a]
+        Move,                   // dst = a
+        Store,                  // dst = a, casted to the type of dst
+        Evaluate,               // dst = node->evaluate(), for nodes that don't reference any registers
+        Binary,                 // dst = a <op> b, using the operator of node
+        ShortCircuit,           // dst = bool(a) and jump to b if that already decides node's && or ||
+        JumpIfFalse,            // jump to b if the condition a is false
+        TernaryJumpIfFalse,     // jump to b if the ternary condition a is false
+        Jump,                   // jump to b
+        Call,                   // dst = node(a, a + 1, ..., a + b - 1)
+        LoopStart,              // dst = 0
+        LoopIteration,          // dst = dst + 1, checks the loop limit
+        Return,                 // return a
+        ReturnVoid              // return
+    };
+
+    struct Instruction {
+        Opcode opcode;
+        u32 dst = 0, a = 0, b = 0;
+        const ast::ASTNode *node = nullptr;
+    };
+
+    struct Program {
+        std::vector<Instruction> instructions;
+        std::vector<Token::Literal> constants;
+
+        // Type of every register. Parameters and local variables hold their declared type,
+        // temporaries and 'auto' parameters hold ValueType::Any
+        std::vector<Token::ValueType> registerTypes;
+        u32 parameterCount = 0;
+    };
+
+    /**
+     * @brief Lowers the body of a function into bytecode
+     * @param function Function to compile
+     * @return Compiled program or nullptr if the function uses constructs the VM doesn't support
+     */
+    [[nodiscard]] std::unique_ptr<Program> compile(const ast::ASTNodeFunctionDefinition *function);
+
+    class VirtualMachine {
+    public:
+        /**
+         * @brief Checks if a program can be executed with the given parameters
+         * @note Parameters that are patterns or strings need the full variable semantics of the AST interpreter
+         */
+        [[nodiscard]] static bool canExecute(const Program &program, std::span<const Token::Literal> params);
+
+        std::optional<Token::Literal> execute(Evaluator *evaluator, const Program &program, std::span<const Token::Literal> params);
+
+        /**
+         * @brief Returns how many function calls were executed as bytecode instead of falling back to the AST interpreter
+         */
+        [[nodiscard]] u64 getExecutedProgramCount() const { return this->m_executedProgramCount; }
+
+    private:
+        // Deques keep references to registers valid while nested calls grow the register stack
+        std::deque<std::optional<Token::Literal>> m_registers;
+        std::deque<Token::ValueType> m_registerTypes;
+        u64 m_executedProgramCount = 0;
+    };
+
+}
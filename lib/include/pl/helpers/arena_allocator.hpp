@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace pl::hlp {
+
+    /**
+     * @brief Allocator that hands out memory from a shared memory resource
+     * @note Every copy of the allocator keeps the resource alive. Objects created through std::allocate_shared
+     *       therefore keep their arena around until the last one of them is destroyed, no matter who else released it
+     * @tparam T Type to allocate
+     */
+    template<typename T>
+    class ArenaAllocator {
+    public:
+        using value_type = T;
+
+        explicit ArenaAllocator(std::shared_ptr<std::pmr::memory_resource> resource) : m_resource(std::move(resource)) { }
+
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U> &other) : m_resource(other.getResource()) { }
+
+        [[nodiscard]] T *allocate(std::size_t count) {
+            return static_cast<T*>(this->m_resource->allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T *pointer, std::size_t count) {
+            this->m_resource->deallocate(pointer, count * sizeof(T), alignof(T));
+        }
+
+        [[nodiscard]] const std::shared_ptr<std::pmr::memory_resource> &getResource() const {
+            return this->m_resource;
+        }
+
+        template<typename U>
+        [[nodiscard]] bool operator==(const ArenaAllocator<U> &other) const {
+            return this->m_resource == other.getResource();
+        }
+
+    private:
+        std::shared_ptr<std::pmr::memory_resource> m_resource;
+    };
+
+}
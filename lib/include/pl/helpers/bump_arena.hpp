@@ -0,0 +1,128 @@
+#pragma once
+
+#include <pl/helpers/types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace pl::hlp {
+
+    /**
+     * @brief Allocator that hands out memory by moving a pointer forward through a list of chunks
+     * @note Memory can't be freed individually. Instead, the arena gets rewound to a marker taken earlier, which releases everything
+     *       allocated after it at once. Chunks are kept around after rewinding so later allocations don't need to allocate again
+     */
+    class BumpArena {
+    public:
+        /**
+         * @brief Position in the arena, everything allocated after it gets released by rewind()
+         */
+        struct Marker {
+            size_t chunk = 0;
+            size_t offset = 0;
+        };
+
+        explicit BumpArena(size_t chunkSize = DefaultChunkSize) : m_chunkSize(chunkSize) { }
+
+        BumpArena(const BumpArena &) = delete;
+        BumpArena& operator=(const BumpArena &) = delete;
+
+        /**
+         * @brief Allocates uninitialized memory
+         * @param size Number of bytes
+         * @return Pointer to the memory, valid until the arena gets rewound to a marker taken before this call
+         */
+        [[nodiscard]] u8 *allocate(size_t size) {
+            size = getAllocationSize(size);
+
+            if (this->m_chunks.empty() || this->m_offset + size > this->m_chunks[this->m_chunk].size) {
+                // Nothing after the current chunk is in use, the next one can be reused or replaced if it's too small
+                const auto nextChunk = this->m_chunks.empty() ? 0 : this->m_chunk + 1;
+                if (nextChunk == this->m_chunks.size())
+                    this->m_chunks.emplace_back();
+
+                auto &chunk = this->m_chunks[nextChunk];
+                if (chunk.size < size) {
+                    chunk.size = std::max(size, this->m_chunkSize);
+                    chunk.data = std::make_unique_for_overwrite<u8[]>(chunk.size);
+                }
+
+                this->m_chunk = nextChunk;
+                this->m_offset = 0;
+            }
+
+            auto result = this->m_chunks[this->m_chunk].data.get() + this->m_offset;
+            this->m_offset += size;
+
+            return result;
+        }
+
+        /**
+         * @brief Grows the last allocation without moving it
+         * @param data Pointer returned by allocate()
+         * @param oldSize Size the memory was allocated with
+         * @param newSize New size
+         * @return True if the allocation was the last one and there was enough space left in its chunk
+         */
+        [[nodiscard]] bool extend(const u8 *data, size_t oldSize, size_t newSize) {
+            if (data == nullptr || this->m_chunks.empty())
+                return false;
+
+            auto &chunk = this->m_chunks[this->m_chunk];
+            if (data + getAllocationSize(oldSize) != chunk.data.get() + this->m_offset)
+                return false;
+
+            const auto newOffset = size_t(data - chunk.data.get()) + getAllocationSize(newSize);
+            if (newOffset > chunk.size)
+                return false;
+
+            this->m_offset = newOffset;
+
+            return true;
+        }
+
+        [[nodiscard]] Marker getMarker() const {
+            return { this->m_chunk, this->m_offset };
+        }
+
+        /**
+         * @brief Releases everything that was allocated after the marker was taken
+         * @param marker Marker returned by getMarker()
+         */
+        void rewind(const Marker &marker) {
+            this->m_chunk = marker.chunk;
+            this->m_offset = marker.offset;
+        }
+
+        /**
+         * @brief Releases all allocations and frees all chunks
+         */
+        void clear() {
+            this->m_chunks.clear();
+            this->m_chunk = 0;
+            this->m_offset = 0;
+        }
+
+    private:
+        constexpr static size_t DefaultChunkSize = 0x10000;
+        constexpr static size_t Alignment = alignof(std::max_align_t);
+
+        // Empty allocations still take up space so no two allocations ever share an address
+        [[nodiscard]] constexpr static size_t getAllocationSize(size_t size) {
+            return (std::max<size_t>(size, 1) + Alignment - 1) & ~(Alignment - 1);
+        }
+
+        struct Chunk {
+            std::unique_ptr<u8[]> data;
+            size_t size = 0;
+        };
+
+        std::vector<Chunk> m_chunks;
+        size_t m_chunk = 0;
+        size_t m_offset = 0;
+        size_t m_chunkSize;
+    };
+
+}
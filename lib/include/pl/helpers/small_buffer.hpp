@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace pl::hlp {
+
+    /**
+     * @brief Resizable buffer that stores up to InlineCapacity elements inside the object itself
+     * @note Only bigger buffers get allocated on the heap. Like std::vector, growing the buffer zero-initializes the new elements
+     *       and clearing it keeps the allocated capacity around for the next use
+     * @tparam T Trivially copyable element type
+     * @tparam InlineCapacity Number of elements stored without allocating
+     */
+    template<typename T, size_t InlineCapacity>
+    class SmallBuffer {
+        static_assert(std::is_trivially_copyable_v<T>, "SmallBuffer only supports trivially copyable types");
+
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        SmallBuffer() = default;
+
+        explicit SmallBuffer(size_t size) {
+            this->resize(size);
+        }
+
+        SmallBuffer(const SmallBuffer &other) {
+            *this = other;
+        }
+
+        SmallBuffer(SmallBuffer &&other) noexcept {
+            *this = std::move(other);
+        }
+
+        SmallBuffer& operator=(const SmallBuffer &other) {
+            if (this == &other)
+                return *this;
+
+            this->m_size = 0;
+            this->reserve(other.m_size);
+            this->m_size = other.m_size;
+            std::copy_n(other.data(), other.m_size, this->data());
+
+            return *this;
+        }
+
+        SmallBuffer& operator=(SmallBuffer &&other) noexcept {
+            if (this == &other)
+                return *this;
+
+            if (other.m_heapData != nullptr) {
+                this->m_heapData = std::move(other.m_heapData);
+                this->m_capacity = other.m_capacity;
+            } else {
+                this->m_heapData.reset();
+                this->m_capacity = InlineCapacity;
+                std::copy_n(other.m_inlineData.data(), other.m_size, this->m_inlineData.data());
+            }
+
+            this->m_size = other.m_size;
+
+            other.m_size = 0;
+            other.m_capacity = InlineCapacity;
+
+            return *this;
+        }
+
+        [[nodiscard]] T *data() { return this->m_heapData != nullptr ? this->m_heapData.get() : this->m_inlineData.data(); }
+        [[nodiscard]] const T *data() const { return this->m_heapData != nullptr ? this->m_heapData.get() : this->m_inlineData.data(); }
+
+        [[nodiscard]] size_t size() const { return this->m_size; }
+        [[nodiscard]] size_t capacity() const { return this->m_capacity; }
+        [[nodiscard]] bool empty() const { return this->m_size == 0; }
+
+        /**
+         * @brief Checks if the elements are stored inside the object without a heap allocation
+         */
+        [[nodiscard]] bool isInline() const { return this->m_heapData == nullptr; }
+
+        [[nodiscard]] iterator begin() { return this->data(); }
+        [[nodiscard]] iterator end() { return this->data() + this->m_size; }
+        [[nodiscard]] const_iterator begin() const { return this->data(); }
+        [[nodiscard]] const_iterator end() const { return this->data() + this->m_size; }
+
+        [[nodiscard]] T &operator[](size_t index) { return this->data()[index]; }
+        [[nodiscard]] const T &operator[](size_t index) const { return this->data()[index]; }
+
+        void reserve(size_t capacity) {
+            if (capacity <= this->m_capacity)
+                return;
+
+            auto heapData = std::make_unique_for_overwrite<T[]>(capacity);
+            std::copy_n(this->data(), this->m_size, heapData.get());
+
+            this->m_heapData = std::move(heapData);
+            this->m_capacity = capacity;
+        }
+
+        void resize(size_t size) {
+            if (size > this->m_capacity)
+                this->reserve(std::max(size, this->m_capacity * 2));
+
+            if (size > this->m_size)
+                std::fill(this->data() + this->m_size, this->data() + size, T());
+
+            this->m_size = size;
+        }
+
+        void clear() {
+            this->m_size = 0;
+        }
+
+    private:
+        size_t m_size = 0;
+        size_t m_capacity = InlineCapacity;
+        std::unique_ptr<T[]> m_heapData;
+        std::array<T, InlineCapacity> m_inlineData = { };
+    };
+
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <pl/helpers/types.hpp>
+
+#include <deque>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pl::hlp {
+
+    /**
+     * @brief Open addressing string interner that hands out stable 32-bit handles
+     * @note Interned strings never move, views returned by get() stay valid until the interner is cleared
+     */
+    class StringInterner {
+    public:
+        using Handle = u32;
+        constexpr static Handle InvalidHandle = 0;
+
+        /**
+         * @brief Returns the handle of a string, interning it if it hasn't been seen before
+         * @param string String to intern
+         * @return Handle of the string
+         */
+        [[nodiscard]] Handle intern(std::string_view string) {
+            if (string.empty())
+                return InvalidHandle;
+
+            if ((this->m_strings.size() + 1) * 2 > this->m_slots.size())
+                this->grow();
+
+            const auto hash = std::hash<std::string_view>{}(string);
+            auto &slot = this->m_slots[this->findSlot(string, hash)];
+            if (slot == InvalidHandle) {
+                this->m_strings.emplace_back(string);
+                this->m_hashes.push_back(hash);
+                slot = Handle(this->m_strings.size());
+            }
+
+            return slot;
+        }
+
+        /**
+         * @brief Looks up the handle of a string without interning it
+         * @param string String to look up
+         * @return Handle of the string or InvalidHandle if it was never interned
+         */
+        [[nodiscard]] Handle find(std::string_view string) const {
+            if (string.empty() || this->m_slots.empty())
+                return InvalidHandle;
+
+            return this->m_slots[this->findSlot(string, std::hash<std::string_view>{}(string))];
+        }
+
+        /**
+         * @brief Returns the string of a handle
+         * @param handle Handle to resolve
+         * @return Interned string or an empty view if the handle isn't valid
+         */
+        [[nodiscard]] std::string_view get(Handle handle) const {
+            if (!this->isValid(handle))
+                return { };
+
+            return this->m_strings[handle - 1];
+        }
+
+        [[nodiscard]] bool isValid(Handle handle) const {
+            return handle != InvalidHandle && handle <= this->m_strings.size();
+        }
+
+        [[nodiscard]] size_t size() const {
+            return this->m_strings.size();
+        }
+
+        void clear() {
+            this->m_strings.clear();
+            this->m_hashes.clear();
+            std::fill(this->m_slots.begin(), this->m_slots.end(), InvalidHandle);
+        }
+
+    private:
+        [[nodiscard]] size_t findSlot(std::string_view string, size_t hash) const {
+            const auto mask = this->m_slots.size() - 1;
+
+            for (auto index = hash & mask; ; index = (index + 1) & mask) {
+                const auto handle = this->m_slots[index];
+                if (handle == InvalidHandle)
+                    return index;
+                if (this->m_hashes[handle - 1] == hash && this->m_strings[handle - 1] == string)
+                    return index;
+            }
+        }
+
+        void grow() {
+            this->m_slots.assign(std::max<size_t>(this->m_slots.size() * 2, 64), InvalidHandle);
+
+            const auto mask = this->m_slots.size() - 1;
+            for (Handle handle = 1; handle <= this->m_strings.size(); handle++) {
+                auto index = this->m_hashes[handle - 1] & mask;
+                while (this->m_slots[index] != InvalidHandle)
+                    index = (index + 1) & mask;
+
+                this->m_slots[index] = handle;
+            }
+        }
+
+        std::deque<std::string> m_strings;
+        std::vector<size_t> m_hashes;
+        std::vector<Handle> m_slots;
+    };
+
+}
@@ -2,12 +2,14 @@
 
 #include <atomic>
 #include <bit>
+#include <concepts>
 #include <map>
 #include <optional>
 #include <string>
 #include <vector>
 #include <filesystem>
 #include <set>
+#include <span>
 #include <thread>
 
 #include <pl/api.hpp>
@@ -18,6 +20,7 @@
 #include <pl/core/resolver.hpp>
 #include <pl/core/resolvers.hpp>
 #include <pl/core/parser_manager.hpp>
+#include <pl/core/vm.hpp>
 
 #include <pl/helpers/types.hpp>
 
@@ -161,6 +164,48 @@ namespace pl {
          */
         void setDefaultEndian(std::endian endian);
 
+        /**
+         * @brief Sets the engine used to execute functions
+         * @note Functions the bytecode VM doesn't support are always executed by the AST interpreter
+         * @param engine Engine to use
+         */
+        void setExecutionEngine(core::ExecutionEngine engine);
+
+        /**
+         * @brief Sets the mode used to evaluate patterns
+         * @note Release mode skips all debugger hooks and is meant for batch runs that never use breakpoints
+         * @param mode Mode to use
+         */
+        void setEvaluationMode(core::EvaluationMode mode);
+
+        /**
+         * @brief Sets the number of threads used to evaluate independent top-level placements in release mode
+         * @note The data source needs to support being read from multiple threads at once
+         * @param count Number of threads to use
+         */
+        void setWorkerCount(u32 count);
+
+        /**
+         * @brief Enables allocating the patterns of each run from a single arena
+         * @note The arena of a run is released as a whole once its patterns are no longer referenced
+         * @param enabled Whether to use a pattern arena
+         */
+        void setPatternArenaEnabled(bool enabled);
+
+        /**
+         * @brief Enables keeping the compiled program around between executions
+         * @note Running unchanged code with the same defines, include paths and pragma handlers again then skips the preprocessor, parser and validator
+         * @param enabled Whether to use the compile cache
+         */
+        void setCompileCacheEnabled(bool enabled);
+
+        /**
+         * @brief Sets the directory used to store the tokens of included files between runs and processes
+         * @note Entries are validated against the content of the included file, an empty path disables the cache
+         * @param path Cache directory
+         */
+        void setTokenCachePath(const std::fs::path &path);
+
         /**
          * @brief Sets the initial cursor position used at the start of  execution
          * @param address Initial cursor position
@@ -319,6 +364,19 @@ namespace pl {
          */
         void addFunction(const api::Namespace &ns, const std::string &name, api::FunctionParameterCount parameterCount, const api::FunctionCallback &func);
 
+        /**
+         * @brief Adds a new built-in function to the pattern language that receives its parameters as a span
+         * @note The span is only valid for the duration of the call. Unlike the vector based overload, calling such a function doesn't allocate
+         * @param ns Namespace of the function
+         * @param name Name of the function
+         * @param parameterCount Number of parameters the function takes
+         * @param func Callback to execute when the function is called
+         */
+        template<typename Callback> requires api::SpanFunctionCallback<Callback>
+        void addFunction(const api::Namespace &ns, const std::string &name, api::FunctionParameterCount parameterCount, Callback &&func) {
+            this->m_functions.emplace_back(ns, name, parameterCount, api::FunctionSpanCallback(std::forward<Callback>(func)), false);
+        }
+
         /**
          * @brief Adds a new dangerous built-in function to the pattern language
          * @param ns Namespace of the function
@@ -328,6 +386,19 @@ namespace pl {
          */
         void addDangerousFunction(const api::Namespace &ns, const std::string &name, api::FunctionParameterCount parameterCount, const api::FunctionCallback &func);
 
+        /**
+         * @brief Adds a new dangerous built-in function to the pattern language that receives its parameters as a span
+         * @note The span is only valid for the duration of the call
+         * @param ns Namespace of the function
+         * @param name Name of the function
+         * @param parameterCount Number of parameters the function takes
+         * @param func Callback to execute when the function is called
+         */
+        template<typename Callback> requires api::SpanFunctionCallback<Callback>
+        void addDangerousFunction(const api::Namespace &ns, const std::string &name, api::FunctionParameterCount parameterCount, Callback &&func) {
+            this->m_functions.emplace_back(ns, name, parameterCount, api::FunctionSpanCallback(std::forward<Callback>(func)), true);
+        }
+
         /**
          * @brief Adds a new custom built-in type to the pattern language
          * @param ns Namespace of the type
@@ -413,6 +484,10 @@ namespace pl {
 
     private:
         void flattenPatterns();
+        void resetEvaluation();
+
+        [[nodiscard]] std::optional<std::vector<std::shared_ptr<core::ast::ASTNode>>> loadCompiledProgram(const std::string &code, const std::string &source);
+        void storeCompiledProgram(const std::string &code, const std::string &source);
 
     private:
         Internals m_internals;
@@ -433,6 +508,19 @@ namespace pl {
         std::vector<std::function<void(PatternLanguage&)>> m_cleanupCallbacks;
         std::vector<std::shared_ptr<core::ast::ASTNode>> m_currAST;
 
+        struct CompiledProgram {
+            std::string code, source;
+            std::map<std::string, std::string> defines;
+            std::vector<std::fs::path> includePaths;
+            std::vector<std::string> pragmaHandlers;
+
+            std::map<std::string, size_t> resolvedSources;
+            std::vector<std::pair<std::string, std::string>> pragmas;
+            std::vector<std::shared_ptr<core::ast::ASTNode>> ast;
+        };
+        std::optional<CompiledProgram> m_compiledProgram;
+        std::map<std::string, size_t> m_resolvedSources;
+
         std::atomic<bool> m_running = false;
         std::atomic<bool> m_patternsValid = false;
         std::atomic<bool> m_aborted = false;
@@ -440,6 +528,12 @@ namespace pl {
 
         std::optional<u64> m_startAddress;
         std::endian m_defaultEndian = std::endian::little;
+        core::ExecutionEngine m_executionEngine = core::ExecutionEngine::AST;
+        core::EvaluationMode m_evaluationMode = core::EvaluationMode::Debuggable;
+        u32 m_workerCount = 1;
+        bool m_patternArenaEnabled = false;
+        bool m_compileCacheEnabled = false;
+        std::fs::path m_tokenCachePath;
         double m_runningTime = 0;
 
         u64 m_dataBaseAddress;
@@ -454,7 +548,7 @@ namespace pl {
             api::Namespace nameSpace;
             std::string name;
             api::FunctionParameterCount parameterCount;
-            api::FunctionCallback callback;
+            api::FunctionSpanCallback callback;
             bool dangerous;
         };
         std::vector<Function> m_functions;
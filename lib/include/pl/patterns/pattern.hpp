@@ -1,8 +1,10 @@
 #pragma once
 
+#include <pl/core/attributes.hpp>
 #include <pl/core/errors/error.hpp>
 #include <pl/core/evaluator.hpp>
 #include <pl/pattern_visitor.hpp>
+#include <pl/helpers/arena_allocator.hpp>
 #include <pl/helpers/types.hpp>
 #include <pl/helpers/utils.hpp>
 
@@ -11,7 +13,9 @@
 #include <wolv/utils/core.hpp>
 #include <wolv/utils/guards.hpp>
 
+#include <algorithm>
 #include <concepts>
+#include <limits>
 #include <string>
 
 namespace pl::ptrn {
@@ -35,7 +39,7 @@ namespace pl::ptrn {
 
         [[nodiscard]] virtual std::shared_ptr<Pattern> getEntry(size_t index) const = 0;
         void forEachEntry(u64 start, u64 end, const std::function<void(u64, const std::shared_ptr<Pattern>&)> &callback) {
-            forEachEntryImpl(this->getEntries(), start, end, callback);
+            forEachEntryImpl(this->getIteratedEntries(), start, end, callback);
         }
 
         void forEachEntrySorted(u64 start, u64 end, const std::function<void(u64, const std::shared_ptr<Pattern>&)> &callback) {
@@ -49,6 +53,14 @@ namespace pl::ptrn {
         }
 
     protected:
+        /**
+         * @brief Entries handed to forEachEntryImpl() when iterating
+         * @note Patterns that create their entries while iterating return none so not all of them get created up front
+         */
+        [[nodiscard]] virtual std::vector<std::shared_ptr<Pattern>> getIteratedEntries() {
+            return this->getEntries();
+        }
+
         virtual void forEachEntryImpl(const std::vector<std::shared_ptr<Pattern>> &patterns, u64 start, u64 end, const std::function<void(u64, const std::shared_ptr<Pattern>&)> &callback) = 0;
     };
 
@@ -84,8 +96,6 @@ namespace pl::ptrn {
             if (evaluator != nullptr) {
                 this->m_color       = evaluator->getNextPatternColor();
                 this->m_manualColor = false;
-                this->m_variableName = m_evaluator->getStringPool().end();
-                this->m_typeName = m_evaluator->getStringPool().end();
 
                 evaluator->patternCreated(this);
             }
@@ -95,7 +105,8 @@ namespace pl::ptrn {
         Pattern(const Pattern &other) : std::enable_shared_from_this<Pattern>(other) {
             this->m_evaluator = other.m_evaluator;
             this->m_offset = other.m_offset;
-            this->m_endian = other.m_endian;
+            this->m_hasEndian = other.m_hasEndian;
+            this->m_bigEndian = other.m_bigEndian;
             this->m_size = other.m_size;
             this->m_color = other.m_color;
             this->m_manualColor = other.m_manualColor;
@@ -110,10 +121,13 @@ namespace pl::ptrn {
             this->m_arrayIndex = other.m_arrayIndex;
             this->m_line = other.m_line;
 
-            if (other.m_cachedDisplayValue != nullptr)
-                this->m_cachedDisplayValue = std::make_unique<std::string>(*other.m_cachedDisplayValue);
-            if (other.m_attributes != nullptr)
-                this->m_attributes = std::make_unique<std::map<std::string, std::vector<core::Token::Literal>>>(*other.m_attributes);
+            if (other.m_coldData != nullptr && (other.m_coldData->cachedDisplayValue.has_value() || !other.m_coldData->attributes.empty())) {
+                auto &coldData = this->getColdData();
+                coldData.cachedDisplayValue = other.m_coldData->cachedDisplayValue;
+                coldData.attributes = other.m_coldData->attributes;
+                coldData.attributeIds = other.m_coldData->attributeIds;
+            }
+            this->m_attributeFlags = other.m_attributeFlags;
 
             if (this->m_evaluator != nullptr) {
                 this->m_evaluator->patternCreated(this);
@@ -135,6 +149,17 @@ namespace pl::ptrn {
             return shared_from_this();
         }
 
+        /**
+         * @brief Creates a new pattern, placing it in the evaluator's pattern arena if there is one
+         * @param evaluator Evaluator the pattern belongs to
+         * @param args Remaining constructor arguments
+         * @return Newly created pattern
+         */
+        template<std::derived_from<Pattern> T, typename ... Args>
+        [[nodiscard]] static std::shared_ptr<T> create(core::Evaluator *evaluator, Args && ... args) {
+            return allocate<T>(evaluator, evaluator, std::forward<Args>(args)...);
+        }
+
         [[nodiscard]] u64 getOffset() const { return this->m_offset; }
         [[nodiscard]] virtual u128 getOffsetForSorting() const { return this->getOffset() << 3; }
         [[nodiscard]] u32 getHeapAddress() const { return this->getOffset() >> 32; }
@@ -157,23 +182,46 @@ namespace pl::ptrn {
 
         [[nodiscard]] std::string getVariableName() const {
             if (!hasVariableName()) {
-                if (this->m_arrayIndex.has_value())
-                    return fmt::format("[{}]", m_arrayIndex.value());
+                if (this->m_arrayIndex != NoArrayIndex)
+                    return fmt::format("[{}]", this->m_arrayIndex);
                 else
                     return fmt::format("{} @ 0x{:02X}", this->getTypeName(), this->getOffset());
             } else
-                return *this->m_variableName;
+                return std::string(this->getStringPool().get(this->m_variableName));
         }
 
         [[nodiscard]] bool hasVariableName() const {
-            return getEvaluator()->isStringPoolEntryValid(this->m_variableName);
+            return this->getStringPool().isValid(this->m_variableName);
+        }
+
+        /**
+         * @brief Checks if the pattern is named exactly like the given name without creating a copy of its name
+         * @param name Name to compare against
+         * @return True if the pattern has a variable name and it's equal to name
+         */
+        [[nodiscard]] bool hasVariableName(std::string_view name) const {
+            return this->hasVariableName() && this->getStringPool().get(this->m_variableName) == name;
+        }
+
+        /**
+         * @brief Checks if two patterns have the same variable name
+         * @note Patterns of the same evaluator share a string pool so this boils down to comparing handles
+         * @param other Pattern to compare against
+         * @return True if both patterns have a variable name and they are equal
+         */
+        [[nodiscard]] bool hasSameVariableName(const Pattern &other) const {
+            if (!this->hasVariableName() || !other.hasVariableName())
+                return false;
+
+            if (this->m_evaluator == other.m_evaluator)
+                return this->m_variableName == other.m_variableName;
+            else
+                return this->getStringPool().get(this->m_variableName) == other.getStringPool().get(other.m_variableName);
         }
 
         void setVariableName(const std::string &name) {
-            if (!name.empty()) {
-                auto [it, inserted] = m_evaluator->getStringPool().emplace(name);
-                this->m_variableName = it;
-            }
+            if (!name.empty())
+                this->m_variableName = this->m_evaluator->getStringPool().intern(name);
         }
 
         [[nodiscard]] std::string getComment() const {
@@ -189,17 +237,12 @@ namespace pl::ptrn {
         }
 
         [[nodiscard]] virtual std::string getTypeName() const {
-            if (!getEvaluator()->isStringPoolEntryValid(this->m_typeName))
-                return "";
-            else
-                return *this->m_typeName;
+            return std::string(this->getStringPool().get(this->m_typeName));
         }
 
         void setTypeName(const std::string &name) {
-            if (!name.empty()) {
-                auto [it, inserted] = m_evaluator->getStringPool().emplace(name);
-                this->m_typeName = it;
-            }
+            if (!name.empty())
+                this->m_typeName = this->m_evaluator->getStringPool().intern(name);
         }
 
         [[nodiscard]] u32 getColor() const { return this->m_color; }
@@ -217,15 +260,16 @@ namespace pl::ptrn {
 
         [[nodiscard]] std::endian getEndian() const {
             if (this->m_evaluator == nullptr) return std::endian::native;
-            else return this->m_endian.value_or(this->m_evaluator->getDefaultEndian());
+            else return this->getEndianOverride().value_or(this->m_evaluator->getDefaultEndian());
         }
         virtual void setEndian(std::endian endian) {
             if (m_section == HeapSectionId || m_section == PatternLocalSectionId || m_section == InstantiationSectionId)
                 return;
 
-            this->m_endian = endian;
+            this->m_hasEndian = true;
+            this->m_bigEndian = endian == std::endian::big;
         }
-        [[nodiscard]] bool hasOverriddenEndian() const { return this->m_endian.has_value(); }
+        [[nodiscard]] bool hasOverriddenEndian() const { return this->m_hasEndian; }
 
         [[nodiscard]] std::string getDisplayName() const {
             if (const auto &arguments = this->getAttributeArguments("name"); !arguments.empty())
@@ -260,8 +304,8 @@ namespace pl::ptrn {
         [[nodiscard]] virtual std::string getFormattedName() const = 0;
 
         [[nodiscard]] std::string getFormattedValue() {
-            if (this->m_cachedDisplayValue != nullptr)
-                return *this->m_cachedDisplayValue;
+            if (this->m_coldData != nullptr && this->m_coldData->cachedDisplayValue.has_value())
+                return *this->m_coldData->cachedDisplayValue;
 
             try {
                 auto startOffset = this->m_evaluator->getReadOffset();
@@ -272,15 +316,16 @@ namespace pl::ptrn {
                 };
 
                 auto result = this->formatDisplayValue();
-                this->m_cachedDisplayValue = std::make_unique<std::string>(result);
+                this->getColdData().cachedDisplayValue = result;
                 this->m_validDisplayValue = true;
 
                 return result;
             } catch(std::exception &e) {
-                this->m_cachedDisplayValue = std::make_unique<std::string>(e.what());
+                auto &cachedDisplayValue = this->getColdData().cachedDisplayValue;
+                cachedDisplayValue = e.what();
                 this->m_validDisplayValue = false;
 
-                return *this->m_cachedDisplayValue;
+                return *cachedDisplayValue;
             }
         }
 
@@ -314,34 +359,34 @@ namespace pl::ptrn {
         void setVisibility(Visibility visibility) {
             switch (visibility) {
                 case Visibility::Visible:
-                    this->removeAttribute("hidden");
-                    this->removeAttribute("highlight_hidden");
-                    this->removeAttribute("tree_hidden");
+                    this->removeAttribute(core::attr::Hidden);
+                    this->removeAttribute(core::attr::HighlightHidden);
+                    this->removeAttribute(core::attr::TreeHidden);
                     break;
                 case Visibility::Hidden:
-                    this->addAttribute("hidden");
-                    this->removeAttribute("highlight_hidden");
-                    this->removeAttribute("tree_hidden");
+                    this->addAttribute(core::attr::Hidden);
+                    this->removeAttribute(core::attr::HighlightHidden);
+                    this->removeAttribute(core::attr::TreeHidden);
                     break;
                 case Visibility::HighlightHidden:
-                    this->removeAttribute("hidden");
-                    this->addAttribute("highlight_hidden");
-                    this->removeAttribute("tree_hidden");
+                    this->removeAttribute(core::attr::Hidden);
+                    this->addAttribute(core::attr::HighlightHidden);
+                    this->removeAttribute(core::attr::TreeHidden);
                     break;
                 case Visibility::TreeHidden:
-                    this->removeAttribute("hidden");
-                    this->removeAttribute("highlight_hidden");
-                    this->addAttribute("tree_hidden");
+                    this->removeAttribute(core::attr::Hidden);
+                    this->removeAttribute(core::attr::HighlightHidden);
+                    this->addAttribute(core::attr::TreeHidden);
                     break;
             }
         }
 
         [[nodiscard]] Visibility getVisibility() const {
-            if (this->hasAttribute("hidden"))
+            if (this->hasAttribute(core::attr::Hidden))
                 return Visibility::Hidden;
-            else if (this->hasAttribute("highlight_hidden"))
+            else if (this->hasAttribute(core::attr::HighlightHidden))
                 return Visibility::HighlightHidden;
-            else if (this->hasAttribute("tree_hidden"))
+            else if (this->hasAttribute(core::attr::TreeHidden))
                 return Visibility::TreeHidden;
             else
                 return Visibility::Visible;
@@ -349,13 +394,13 @@ namespace pl::ptrn {
 
         void setSealed(bool sealed) {
             if (sealed)
-                this->addAttribute("sealed");
+                this->addAttribute(core::attr::Sealed);
             else
-                this->removeAttribute("sealed");
+                this->removeAttribute(core::attr::Sealed);
         }
 
         [[nodiscard]] bool isSealed() const {
-            return this->hasAttribute("sealed") || this->getVisibility() == Visibility::Hidden;
+            return this->hasAttribute(core::attr::Sealed) || this->hasAttribute(core::attr::Hidden);
         }
 
         virtual void setLocal(bool local) {
@@ -417,8 +462,8 @@ namespace pl::ptrn {
 
         virtual std::vector<u8> getRawBytes() = 0;
         const std::vector<u8>& getBytes() {
-            if (this->m_cachedBytes != nullptr)
-                return *this->m_cachedBytes;
+            if (this->m_coldData != nullptr && this->m_coldData->cachedBytes.has_value())
+                return *this->m_coldData->cachedBytes;
 
             std::vector<u8> result;
             if (!this->getTransformFunction().empty()) {
@@ -444,9 +489,10 @@ namespace pl::ptrn {
                 result = this->getRawBytes();
             }
 
-            this->m_cachedBytes = std::make_unique<std::vector<u8>>(std::move(result));
+            auto &cachedBytes = this->getColdData().cachedBytes;
+            cachedBytes = std::move(result);
 
-            return *this->m_cachedBytes;
+            return *cachedBytes;
         }
 
         virtual std::vector<u8> getBytesOf(const core::Token::Literal &value) const {
@@ -468,10 +514,10 @@ namespace pl::ptrn {
                 try {
                     const auto function = this->m_evaluator->findFunction(formatterFunctionName);
                     if (function.has_value()) {
-                        auto startHeap = this->m_evaluator->getHeap();
-                        ON_SCOPE_EXIT { this->m_evaluator->getHeap() = startHeap; };
+                        const auto heapCheckpoint = this->m_evaluator->createHeapCheckpoint();
+                        ON_SCOPE_EXIT { this->m_evaluator->restoreHeapCheckpoint(heapCheckpoint); };
 
-                        auto formatterResult = function->func(this->m_evaluator, { value });
+                        auto formatterResult = function->func(this->m_evaluator, std::span(&value, 1));
                         if (formatterResult.has_value()) {
                             result = this->getBytesOf(*formatterResult);
                         }
@@ -488,14 +534,15 @@ namespace pl::ptrn {
         }
 
         virtual void clearFormatCache() {
-            this->m_cachedDisplayValue.reset();
+            if (this->m_coldData != nullptr)
+                this->m_coldData->cachedDisplayValue.reset();
         }
 
         void clearByteCache() {
-            if (this->m_cachedBytes == nullptr)
+            if (this->m_coldData == nullptr || !this->m_coldData->cachedBytes.has_value())
                 return;
 
-            this->m_cachedBytes.reset();
+            this->m_coldData->cachedBytes.reset();
 
             if (auto *iterable = dynamic_cast<IIterable*>(this); iterable != nullptr) [[unlikely]] {
                 iterable->forEachEntry(0, iterable->getEntryCount(), [](u64, const auto &pattern) {
@@ -506,40 +553,75 @@ namespace pl::ptrn {
 
         virtual void accept(PatternVisitor &v) = 0;
 
+        void addAttribute(core::AttributeId id, const std::vector<core::Token::Literal> &arguments = {}) {
+            auto &coldData = this->getColdData();
+            coldData.attributes[core::getAttributeName(id)] = arguments;
+
+            if (core::attr::isFlag(id)) {
+                this->m_attributeFlags |= u8(1U << id);
+            } else if (std::ranges::find(coldData.attributeIds, id) == coldData.attributeIds.end()) {
+                coldData.attributeIds.push_back(id);
+            }
+
+            getEvaluator()->addAttributedPattern(id, this);
+        }
+
         void addAttribute(const std::string &attribute, const std::vector<core::Token::Literal> &arguments = {}) {
-            if (this->m_attributes == nullptr)
-                this->m_attributes = std::make_unique<std::map<std::string, std::vector<core::Token::Literal>>>();
+            this->addAttribute(core::internAttribute(attribute), arguments);
+        }
+
+        void removeAttribute(core::AttributeId id) {
+            if (!this->hasAttribute(id))
+                return;
+
+            this->m_coldData->attributes.erase(core::getAttributeName(id));
+
+            if (core::attr::isFlag(id))
+                this->m_attributeFlags &= u8(~(1U << id));
+            else
+                std::erase(this->m_coldData->attributeIds, id);
 
-            (*this->m_attributes)[attribute] = arguments;
-            getEvaluator()->addAttributedPattern(attribute, this);
+            getEvaluator()->removeAttributedPattern(id, this);
         }
 
         void removeAttribute(const std::string &attribute) {
-            if (this->m_attributes != nullptr)
-                this->m_attributes->erase(attribute);
-            getEvaluator()->removeAttributedPattern(attribute, this);
+            if (const auto id = core::findAttribute(attribute); id.has_value())
+                this->removeAttribute(*id);
+        }
+
+        [[nodiscard]] bool hasAttribute(core::AttributeId id) const {
+            if (core::attr::isFlag(id))
+                return (this->m_attributeFlags & (1U << id)) != 0;
+
+            if (this->m_coldData == nullptr)
+                return false;
+
+            return std::ranges::find(this->m_coldData->attributeIds, id) != this->m_coldData->attributeIds.end();
         }
 
         [[nodiscard]] bool hasAttribute(const std::string &attribute) const {
-            if (this->m_attributes == nullptr)
+            if (this->m_coldData == nullptr)
                 return false;
 
-            return this->m_attributes->contains(attribute);
+            return this->m_coldData->attributes.contains(attribute);
         }
 
-        [[nodiscard]] const auto &getAttributes() const {
-            return this->m_attributes;
+        [[nodiscard]] const std::map<std::string, std::vector<core::Token::Literal>>* getAttributes() const {
+            if (this->m_coldData == nullptr || this->m_coldData->attributes.empty())
+                return nullptr;
+
+            return &this->m_coldData->attributes;
         }
 
         [[nodiscard]] std::vector<core::Token::Literal> getAttributeArguments(const std::string &name) const {
             if (!this->hasAttribute(name))
                 return {};
             else
-                return this->m_attributes->at(name);
+                return this->m_coldData->attributes.at(name);
         }
 
         void setFormatValue(const std::string &value) {
-            this->m_cachedDisplayValue = std::make_unique<std::string>(value);
+            this->getColdData().cachedDisplayValue = value;
         }
 
         [[nodiscard]] core::Evaluator* getEvaluator() const {
@@ -577,20 +659,32 @@ namespace pl::ptrn {
         [[nodiscard]] u32 getLine() const { return m_line; }
 
         void setArrayIndex(u64 index) {
-            m_arrayIndex = index;
+            this->m_arrayIndex = index;
         }
 
         [[nodiscard]] virtual std::string formatDisplayValue() = 0;
 
     protected:
-        std::optional<std::endian> m_endian;
+        template<std::derived_from<Pattern> T>
+        [[nodiscard]] std::shared_ptr<T> copy(const T &other) const {
+            return allocate<T>(this->m_evaluator, other);
+        }
+
+        /**
+         * @brief Gives a copy of a pattern its own color and registers its attributes, like a newly created pattern would get
+         * @param pattern Copy to register
+         */
+        void registerCopy(Pattern *pattern) const {
+            if (this->m_evaluator != nullptr)
+                this->m_evaluator->registerTypeLayoutInstance(pattern);
+        }
 
         [[nodiscard]] core::Token::Literal transformValue(const core::Token::Literal &value) const {
             auto evaluator = this->getEvaluator();
 
             if (auto transformFunc = evaluator->findFunction(this->getTransformFunction()); transformFunc.has_value()) {
-                auto startHeap = this->m_evaluator->getHeap();
-                ON_SCOPE_EXIT { this->m_evaluator->getHeap() = startHeap; };
+                const auto heapCheckpoint = this->m_evaluator->createHeapCheckpoint();
+                ON_SCOPE_EXIT { this->m_evaluator->restoreHeapCheckpoint(heapCheckpoint); };
 
                 // Preserve pattern variable name
                 std::string patternName;
@@ -603,7 +697,7 @@ namespace pl::ptrn {
                 };
 
 
-                if (auto result = transformFunc->func(evaluator, { value }); result.has_value())
+                if (auto result = transformFunc->func(evaluator, std::span(&value, 1)); result.has_value())
                     return *result;
             }
 
@@ -620,8 +714,8 @@ namespace pl::ptrn {
             else {
                 const auto function = this->m_evaluator->findFunction(formatterFunctionName);
                 if (function.has_value()) {
-                    auto startHeap = this->m_evaluator->getHeap();
-                    ON_SCOPE_EXIT { this->m_evaluator->getHeap() = startHeap; };
+                    const auto heapCheckpoint = this->m_evaluator->createHeapCheckpoint();
+                    ON_SCOPE_EXIT { this->m_evaluator->restoreHeapCheckpoint(heapCheckpoint); };
 
                     // Preserve pattern variable name
                     std::string patternName;
@@ -633,7 +727,7 @@ namespace pl::ptrn {
                             literal.toPattern()->setVariableName(patternName);
                     };
 
-                    auto result = function->func(this->m_evaluator, { literal });
+                    auto result = function->func(this->m_evaluator, std::span(&literal, 1));
                     if (result.has_value()) {
                         if (fromCast && result->isPattern() && result->toPattern()->getTypeName() == this->getTypeName()) {
                             return {};
@@ -651,43 +745,89 @@ namespace pl::ptrn {
             return typeid(other) == typeid(std::remove_cvref_t<T>) &&
                    this->m_offset == other.m_offset &&
                    this->m_size == other.m_size &&
-                   (this->m_attributes == nullptr || other.m_attributes == nullptr || *this->m_attributes == *other.m_attributes) &&
-                   (this->m_endian == other.m_endian || (!this->m_endian.has_value() && other.m_endian == std::endian::native) || (!other.m_endian.has_value() && this->m_endian == std::endian::native)) &&
-                   *this->m_variableName == *other.m_variableName &&
-                   *this->m_typeName == *other.m_typeName &&
+                   (this->getAttributes() == nullptr || other.getAttributes() == nullptr || *this->getAttributes() == *other.getAttributes()) &&
+                   (this->getEndianOverride() == other.getEndianOverride() || (!this->m_hasEndian && other.getEndianOverride() == std::endian::native) || (!other.m_hasEndian && this->getEndianOverride() == std::endian::native)) &&
+                   this->hasEqualName(other, &Pattern::m_variableName) &&
+                   this->hasEqualName(other, &Pattern::m_typeName) &&
                    this->m_section == other.m_section;
         }
 
-    protected:
-        std::unique_ptr<std::string> m_cachedDisplayValue;
-        bool m_validDisplayValue = false;
-        std::unique_ptr<std::vector<u8>> m_cachedBytes;
-
     private:
         friend pl::core::Evaluator;
 
+        constexpr static u64 NoArrayIndex = std::numeric_limits<u64>::max();
+
+        /**
+         * @brief Rarely used pattern state that is only allocated once a pattern needs it
+         */
+        struct ColdData {
+            std::map<std::string, std::vector<core::Token::Literal>> attributes;
+            std::vector<core::AttributeId> attributeIds;
+            std::optional<std::string> cachedDisplayValue;
+            std::optional<std::vector<u8>> cachedBytes;
+        };
+
+        [[nodiscard]] const hlp::StringInterner& getStringPool() const {
+            return this->m_evaluator->getStringPool();
+        }
+
+        [[nodiscard]] bool hasEqualName(const Pattern &other, hlp::StringInterner::Handle Pattern::*name) const {
+            if (this->m_evaluator == other.m_evaluator)
+                return this->*name == other.*name;
+            else
+                return this->getStringPool().get(this->*name) == other.getStringPool().get(other.*name);
+        }
+
+        [[nodiscard]] std::optional<std::endian> getEndianOverride() const {
+            if (!this->m_hasEndian)
+                return std::nullopt;
+
+            return this->m_bigEndian ? std::endian::big : std::endian::little;
+        }
+
+        ColdData& getColdData() {
+            if (this->m_coldData == nullptr)
+                this->m_coldData = std::make_unique<ColdData>();
+
+            return *this->m_coldData;
+        }
+
+        template<typename T, typename ... Args>
+        [[nodiscard]] static std::shared_ptr<T> allocate(core::Evaluator *evaluator, Args && ... args) {
+            if (evaluator != nullptr) {
+                if (const auto &arena = evaluator->getPatternArena(); arena != nullptr)
+                    return std::allocate_shared<T>(hlp::ArenaAllocator<T>(arena), std::forward<Args>(args)...);
+            }
+
+            return std::make_shared<T>(std::forward<Args>(args)...);
+        }
+
         core::Evaluator *m_evaluator;
 
-        std::unique_ptr<std::map<std::string, std::vector<core::Token::Literal>>> m_attributes;
+        std::unique_ptr<ColdData> m_coldData;
         std::weak_ptr<Pattern> m_parent;
-        u32 m_line = 0;
 
-        std::set<std::string>::const_iterator m_variableName;
-        std::set<std::string>::const_iterator m_typeName;
-        std::optional<u64> m_arrayIndex;
+        hlp::StringInterner::Handle m_variableName = hlp::StringInterner::InvalidHandle;
+        hlp::StringInterner::Handle m_typeName = hlp::StringInterner::InvalidHandle;
 
         u64 m_offset  = 0x00;
         size_t m_size = 0x00;
         u64 m_section = 0x00;
+        u64 m_arrayIndex = NoArrayIndex;
 
+        u32 m_line = 0;
         u32 m_color = 0x00;
 
-        bool m_reference = false;
-        bool m_inferred = false;
-        bool m_constant = false;
-        bool m_initialized = false;
+        bool m_hasEndian : 1 = false;
+        bool m_bigEndian : 1 = false;
+        bool m_reference : 1 = false;
+        bool m_inferred : 1 = false;
+        bool m_constant : 1 = false;
+        bool m_initialized : 1 = false;
+        bool m_manualColor : 1 = false;
+        bool m_validDisplayValue : 1 = false;
 
-        bool m_manualColor = false;
+        u8 m_attributeFlags = 0x00;
     };
 
 }
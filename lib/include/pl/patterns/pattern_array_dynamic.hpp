@@ -21,7 +21,7 @@ namespace pl::ptrn {
         }
 
         [[nodiscard]] std::shared_ptr<Pattern> clone() const override {
-            auto other = std::make_shared<PatternArrayDynamic>(*this);
+            auto other = this->copy(*this);
             for (const auto &entry : other->m_entries)
                 entry->setParent(other->reference());
 
@@ -128,7 +128,7 @@ namespace pl::ptrn {
                 evaluator->setCurrentArrayIndex(i);
 
                 auto &entry = patterns[i];
-                if (this->hasAttribute("export") || !entry->isPatternLocal() || entry->hasAttribute("export"))
+                if (this->hasAttribute(core::attr::Export) || !entry->isPatternLocal() || entry->hasAttribute(core::attr::Export))
                     fn(i, entry);
             }
         }
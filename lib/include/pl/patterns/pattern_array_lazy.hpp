@@ -0,0 +1,449 @@
+#pragma once
+
+#include <pl/patterns/pattern_array_dynamic.hpp>
+
+#include <array>
+#include <mutex>
+
+namespace pl::ptrn {
+
+    /**
+     * @brief Dynamic array that only keeps the distinct layouts of its entries instead of every entry
+     * @note Entries still get evaluated one after another since their size can depend on the data. An entry whose patterns only
+     *       differ from the ones of an earlier entry by their offset is dropped and recreated from that layout once it's accessed.
+     *       Entries are located through a prefix-offset index that isn't stored at all while the entries have a fixed size
+     */
+    class PatternArrayLazy : public PatternArrayDynamic {
+    public:
+        PatternArrayLazy(core::Evaluator *evaluator, u64 offset, size_t size, u32 line)
+            : PatternArrayDynamic(evaluator, offset, size, line) { }
+
+        PatternArrayLazy(const PatternArrayLazy &other) : PatternArrayDynamic(other) {
+            this->m_layouts.reserve(other.m_layouts.size());
+            for (const auto &layout : other.m_layouts)
+                this->m_layouts.push_back(layout->clone());
+
+            this->m_entryOffsets = other.m_entryOffsets;
+            this->m_entryLayouts = other.m_entryLayouts;
+            this->m_entryCount   = other.m_entryCount;
+            this->m_stride       = other.m_stride;
+            this->m_lastLayout   = other.m_lastLayout;
+        }
+
+        [[nodiscard]] std::shared_ptr<Pattern> clone() const override {
+            auto other = this->copy(*this);
+            for (const auto &layout : other->m_layouts)
+                layout->setParent(other->reference());
+
+            return other;
+        }
+
+        void setColor(u32 color) override {
+            Pattern::setColor(color);
+            for (auto &layout : this->m_layouts) {
+                if (!layout->hasOverriddenColor())
+                    layout->setColor(color);
+            }
+
+            for (auto &highlightTemplate : this->m_highlightTemplates) {
+                if (!highlightTemplate->hasOverriddenColor())
+                    highlightTemplate->setColor(color);
+            }
+
+            this->clearCachedEntries();
+        }
+
+        [[nodiscard]] std::string getFormattedName() const override {
+            if (this->m_layouts.empty())
+                return "???";
+
+            return this->m_layouts.front()->getTypeName() + "[" + std::to_string(this->m_entryCount) + "]";
+        }
+
+        [[nodiscard]] std::string getTypeName() const override {
+            if (this->m_layouts.empty())
+                return "???";
+
+            return this->m_layouts.front()->getTypeName();
+        }
+
+        void setOffset(u64 offset) override {
+            for (auto &layout : this->m_layouts) {
+                if (layout->getSection() == this->getSection() && layout->getSection() != ptrn::Pattern::PatternLocalSectionId)
+                    layout->setOffset(layout->getOffset() - this->getOffset() + offset);
+            }
+
+            Pattern::setOffset(offset);
+            this->clearCachedEntries();
+        }
+
+        void setSection(u64 id) override {
+            if (this->getSection() == id)
+                return;
+
+            for (auto &layout : this->m_layouts)
+                layout->setSection(id);
+
+            for (auto &highlightTemplate : this->m_highlightTemplates)
+                highlightTemplate->setSection(id);
+
+            Pattern::setSection(id);
+            this->clearCachedEntries();
+        }
+
+        [[nodiscard]] std::vector<std::pair<u64, Pattern*>> getChildren() override {
+            if (this->getVisibility() == Visibility::HighlightHidden)
+                return { };
+
+            // Like static arrays, the children of every layout are listed once for every entry using it
+            std::vector<std::vector<std::pair<u64, Pattern*>>> layoutChildren;
+            layoutChildren.reserve(this->m_layouts.size());
+            for (const auto &layout : this->m_layouts) {
+                std::shared_ptr<Pattern> highlightTemplate = layout->clone();
+
+                auto children = this->m_highlightTemplates.emplace_back(std::move(highlightTemplate))->getChildren();
+                for (auto &[address, child] : children)
+                    address -= layout->getOffset();
+
+                layoutChildren.push_back(std::move(children));
+            }
+
+            std::vector<std::pair<u64, Pattern*>> result;
+            for (u64 index = 0; index < this->m_entryCount; index += 1) {
+                const auto &layout = this->m_layouts[this->getLayoutIndex(index)];
+                const auto entryOffset = layout->getSection() == this->getSection() ? this->getOffset() + this->getEntryOffset(index) : layout->getOffset();
+
+                for (const auto &[address, child] : layoutChildren[this->getLayoutIndex(index)])
+                    result.emplace_back(entryOffset + address, child);
+            }
+
+            return result;
+        }
+
+        void setLocal(bool local) override {
+            for (auto &layout : this->m_layouts)
+                layout->setLocal(local);
+
+            for (auto &highlightTemplate : this->m_highlightTemplates)
+                highlightTemplate->setLocal(local);
+
+            Pattern::setLocal(local);
+            this->clearCachedEntries();
+        }
+
+        void setReference(bool reference) override {
+            for (auto &layout : this->m_layouts)
+                layout->setReference(reference);
+
+            for (auto &highlightTemplate : this->m_highlightTemplates)
+                highlightTemplate->setReference(reference);
+
+            Pattern::setReference(reference);
+            this->clearCachedEntries();
+        }
+
+        [[nodiscard]] std::shared_ptr<Pattern> getEntry(size_t index) const override {
+            // Entries in the cache are never handed out, callers get their own copy they may modify
+            return this->getCachedEntry(index)->clone();
+        }
+
+        [[nodiscard]] size_t getEntryCount() const override {
+            return this->m_entryCount;
+        }
+
+        [[nodiscard]] std::vector<std::shared_ptr<Pattern>> getEntries() override {
+            std::vector<std::shared_ptr<Pattern>> entries;
+            entries.reserve(this->m_entryCount);
+            for (u64 index = 0; index < this->m_entryCount; index += 1)
+                entries.push_back(this->getEntry(index));
+
+            return entries;
+        }
+
+        [[nodiscard]] std::vector<std::shared_ptr<Pattern>> getSortedEntries() override {
+            return { };
+        }
+
+        void forEachEntryImpl(const std::vector<std::shared_ptr<Pattern>> &patterns, u64 start, u64 end, const std::function<void(u64, const std::shared_ptr<Pattern>&)>& fn) override {
+            std::ignore = patterns;
+
+            auto evaluator = this->getEvaluator();
+            auto startArrayIndex = evaluator->getCurrentArrayIndex();
+
+            ON_SCOPE_EXIT {
+                if (startArrayIndex.has_value())
+                    evaluator->setCurrentArrayIndex(*startArrayIndex);
+                else
+                    evaluator->clearCurrentArrayIndex();
+            };
+
+            for (u64 i = start; i < std::min<u64>(end, this->m_entryCount); i++) {
+                evaluator->setCurrentArrayIndex(i);
+
+                auto entry = this->getEntry(i);
+                if (this->hasAttribute(core::attr::Export) || !entry->isPatternLocal() || entry->hasAttribute(core::attr::Export))
+                    fn(i, entry);
+            }
+        }
+
+        void sort(const std::function<bool (const Pattern *, const Pattern *)> &comparator) override {
+            for (auto &layout : this->m_layouts)
+                layout->sort(comparator);
+
+            this->clearCachedEntries();
+        }
+
+        void addEntry(const std::shared_ptr<Pattern> &entry) override {
+            if (entry == nullptr) return;
+
+            if (!entry->hasOverriddenColor())
+                entry->setBaseColor(this->getColor());
+
+            const auto index = this->m_entryCount;
+            if (index == 0)
+                this->setBaseColor(entry->getColor());
+
+            u64 entryOffset = 0;
+            if (entry->getSection() == this->getSection()) {
+                // Layouts are kept at the start of the array so entries can be compared with them directly
+                entryOffset = entry->getOffset() - this->getOffset();
+                entry->setOffset(this->getOffset());
+            }
+
+            this->addEntryOffset(index, entryOffset, entry->getSize());
+            this->addEntryLayout(index, this->findLayout(*entry).value_or(u32(this->m_layouts.size())));
+            if (this->getLayoutIndex(index) == this->m_layouts.size())
+                this->m_layouts.push_back(entry);
+
+            this->m_lastLayout = this->getLayoutIndex(index);
+            this->m_entryCount += 1;
+            this->clearCachedEntries();
+        }
+
+        /**
+         * @brief Drops the entry that was added last
+         */
+        void removeLastEntry() {
+            if (this->m_entryCount == 0)
+                return;
+
+            this->m_entryCount -= 1;
+            if (!this->m_entryOffsets.empty())
+                this->m_entryOffsets.pop_back();
+            if (!this->m_entryLayouts.empty())
+                this->m_entryLayouts.pop_back();
+            if (this->m_entryCount == 0)
+                this->m_stride.reset();
+
+            this->clearCachedEntries();
+        }
+
+        void setEntries(const std::vector<std::shared_ptr<Pattern>> &entries) override {
+            this->m_layouts.clear();
+            this->m_entryOffsets.clear();
+            this->m_entryLayouts.clear();
+            this->m_entryCount = 0;
+            this->m_stride.reset();
+            this->m_lastLayout = 0;
+
+            for (const auto &entry : entries)
+                this->addEntry(entry);
+        }
+
+        /**
+         * @brief Returns the number of distinct layouts the entries of this array are created from
+         */
+        [[nodiscard]] size_t getLayoutCount() const {
+            return this->m_layouts.size();
+        }
+
+        [[nodiscard]] std::string toString() override {
+            std::string result;
+
+            result += "[ ";
+
+            const auto entryCount = std::min<u64>(this->m_entryCount, 51);
+            for (u64 index = 0; index < entryCount; index += 1)
+                result += fmt::format("{}, ", this->getCachedEntry(index)->toString());
+
+            if (this->m_entryCount > entryCount)
+                result += fmt::format("..., ");
+
+            if (this->m_entryCount > 0) {
+                // Remove trailing ", "
+                result.pop_back();
+                result.pop_back();
+            }
+
+            result += " ]";
+
+            return Pattern::callUserFormatFunc(this->reference(), true).value_or(result);
+        }
+
+        [[nodiscard]] bool operator==(const Pattern &other) const override {
+            if (!compareCommonProperties<decltype(*this)>(other))
+                return false;
+
+            auto &otherArray = *static_cast<const PatternArrayLazy *>(&other);
+            if (this->m_entryCount != otherArray.m_entryCount || this->m_stride != otherArray.m_stride ||
+                this->m_entryOffsets != otherArray.m_entryOffsets || this->m_entryLayouts != otherArray.m_entryLayouts ||
+                this->m_layouts.size() != otherArray.m_layouts.size())
+                return false;
+
+            for (u64 i = 0; i < this->m_layouts.size(); i++) {
+                if (*this->m_layouts[i] != *otherArray.m_layouts[i])
+                    return false;
+            }
+
+            return true;
+        }
+
+        void setEndian(std::endian endian) override {
+            if (this->isLocal()) return;
+
+            Pattern::setEndian(endian);
+
+            for (auto &layout : this->m_layouts)
+                layout->setEndian(endian);
+
+            this->clearCachedEntries();
+        }
+
+        void clearFormatCache() override {
+            for (auto &layout : this->m_layouts)
+                layout->clearFormatCache();
+
+            for (auto &highlightTemplate : this->m_highlightTemplates)
+                highlightTemplate->clearFormatCache();
+
+            this->clearCachedEntries();
+            Pattern::clearFormatCache();
+        }
+
+    protected:
+        [[nodiscard]] std::vector<std::shared_ptr<Pattern>> getIteratedEntries() override {
+            return { };
+        }
+
+    private:
+        // Number of recently used layouts a new entry gets compared with before it becomes a layout itself
+        constexpr static size_t ComparedLayoutCount = 8;
+        constexpr static size_t CacheSize = 16;
+
+        struct CachedEntry {
+            u64 index;
+            std::shared_ptr<Pattern> pattern;
+        };
+
+        [[nodiscard]] u64 getEntryOffset(u64 index) const {
+            if (this->m_entryOffsets.empty())
+                return index * this->m_stride.value_or(0);
+            else
+                return this->m_entryOffsets[index];
+        }
+
+        [[nodiscard]] u32 getLayoutIndex(u64 index) const {
+            if (this->m_entryLayouts.empty())
+                return 0;
+            else
+                return this->m_entryLayouts[index];
+        }
+
+        void addEntryOffset(u64 index, u64 offset, size_t size) {
+            if (index == 0)
+                this->m_stride = size;
+
+            // Entries of a fixed size don't need an index, only build it once an entry isn't where the stride puts it
+            if (this->m_entryOffsets.empty() && offset == index * this->m_stride.value_or(0))
+                return;
+
+            if (this->m_entryOffsets.empty()) {
+                this->m_entryOffsets.reserve(index + 1);
+                for (u64 i = 0; i < index; i += 1)
+                    this->m_entryOffsets.push_back(i * this->m_stride.value_or(0));
+            }
+
+            this->m_entryOffsets.push_back(offset);
+        }
+
+        void addEntryLayout(u64 index, u32 layout) {
+            if (this->m_entryLayouts.empty() && layout == 0)
+                return;
+
+            if (this->m_entryLayouts.empty())
+                this->m_entryLayouts.resize(index, 0);
+
+            this->m_entryLayouts.push_back(layout);
+        }
+
+        [[nodiscard]] std::optional<u32> findLayout(const Pattern &entry) const {
+            // Entries of other sections keep their own offset and can't be moved to where another entry is
+            if (entry.getSection() != this->getSection())
+                return std::nullopt;
+
+            const auto matches = [&](u32 layout) {
+                const auto &pattern = this->m_layouts[layout];
+                return pattern->getSection() == this->getSection() && pattern->getSize() == entry.getSize() && *pattern == entry;
+            };
+
+            if (this->m_lastLayout < this->m_layouts.size() && matches(this->m_lastLayout))
+                return this->m_lastLayout;
+
+            const auto layoutCount = u32(this->m_layouts.size());
+            for (u32 layout = layoutCount; layout > 0 && layoutCount - layout < ComparedLayoutCount; layout -= 1) {
+                if (layout - 1 != this->m_lastLayout && matches(layout - 1))
+                    return layout - 1;
+            }
+
+            return std::nullopt;
+        }
+
+        [[nodiscard]] std::shared_ptr<Pattern> createEntry(u64 index) const {
+            const auto &layout = this->m_layouts[this->getLayoutIndex(index)];
+
+            auto entry = layout->clone();
+            if (entry->getSection() == this->getSection())
+                entry->setOffset(this->getOffset() + this->getEntryOffset(index));
+            entry->setArrayIndex(index);
+            entry->clearFormatCache();
+            entry->clearByteCache();
+
+            return entry;
+        }
+
+        /**
+         * @brief Returns the entry at an index from the cache, creating it if it isn't in there
+         * @note Cached entries are only used by this array. The cache is guarded since entries may be accessed from other threads
+         *       while the patterns get flattened
+         */
+        [[nodiscard]] std::shared_ptr<Pattern> getCachedEntry(u64 index) const {
+            std::scoped_lock lock(this->m_cacheMutex);
+
+            auto &cachedEntry = this->m_cache[index % CacheSize];
+            if (cachedEntry.pattern == nullptr || cachedEntry.index != index)
+                cachedEntry = { index, this->createEntry(index) };
+
+            return cachedEntry.pattern;
+        }
+
+        void clearCachedEntries() {
+            std::scoped_lock lock(this->m_cacheMutex);
+
+            this->m_cache = { };
+        }
+
+    private:
+        std::vector<std::shared_ptr<Pattern>> m_layouts;
+        std::vector<u64> m_entryOffsets;
+        std::vector<u32> m_entryLayouts;
+        size_t m_entryCount = 0;
+        std::optional<size_t> m_stride;
+        u32 m_lastLayout = 0;
+
+        mutable std::mutex m_cacheMutex;
+        mutable std::array<CachedEntry, CacheSize> m_cache = { };
+        // Highlighted children refer to these, they're kept alive for as long as the array exists
+        std::vector<std::shared_ptr<Pattern>> m_highlightTemplates;
+    };
+
+}
@@ -16,16 +16,18 @@ namespace pl::ptrn {
         }
 
         [[nodiscard]] std::shared_ptr<Pattern> clone() const override {
-            auto other = std::make_shared<PatternArrayStatic>(*this);
+            auto other = this->copy(*this);
             other->m_template->setParent(other->reference());
             return other;
         }
 
         [[nodiscard]] std::shared_ptr<Pattern> getEntry(size_t index) const override {
-            std::shared_ptr<Pattern> highlightTemplate = this->m_template->clone();
-            highlightTemplate->setOffset(this->getOffset() + index * highlightTemplate->getSize());
+            // Entries only exist on demand. Callers may modify the entry they get, so every access creates a fresh one
+            std::shared_ptr<Pattern> entry = this->m_template->clone();
+            entry->setArrayIndex(index);
+            entry->setOffset(this->getOffset() + index * entry->getSize());
 
-            return highlightTemplate;
+            return entry;
         }
 
         [[nodiscard]] std::vector<std::shared_ptr<Pattern>> getEntries() override {
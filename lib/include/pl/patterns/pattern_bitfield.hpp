@@ -66,7 +66,7 @@ namespace pl::ptrn {
         }
 
         [[nodiscard]] std::shared_ptr<Pattern> clone() const override {
-            return std::unique_ptr<Pattern>(new PatternBitfieldField(*this));
+            return this->copy(*this);
         }
 
         [[nodiscard]] u128 readValue() const {
@@ -129,7 +129,7 @@ namespace pl::ptrn {
                 try {
                     const auto function = this->getEvaluator()->findFunction(formatterFunctionName);
                     if (function.has_value()) {
-                        auto formatterResult = function->func(this->getEvaluator(), { value });
+                        auto formatterResult = function->func(this->getEvaluator(), std::span(&value, 1));
 
                         if (formatterResult.has_value()) {
                             result = this->getBytesOf(*formatterResult);
@@ -163,7 +163,7 @@ namespace pl::ptrn {
         using PatternBitfieldField::PatternBitfieldField;
 
         [[nodiscard]] std::shared_ptr<Pattern> clone() const override {
-            return std::unique_ptr<Pattern>(new PatternBitfieldFieldSigned(*this));
+            return this->copy(*this);
         }
 
         [[nodiscard]] core::Token::Literal getValue() const override {
@@ -187,7 +187,7 @@ namespace pl::ptrn {
         using PatternBitfieldField::PatternBitfieldField;
 
         [[nodiscard]] std::shared_ptr<Pattern> clone() const override {
-            return std::unique_ptr<Pattern>(new PatternBitfieldFieldBoolean(*this));
+            return this->copy(*this);
         }
 
         [[nodiscard]] core::Token::Literal getValue() const override {
@@ -242,7 +242,7 @@ namespace pl::ptrn {
         }
 
         [[nodiscard]] std::shared_ptr<Pattern> clone() const override {
-            return std::unique_ptr<Pattern>(new PatternBitfieldFieldEnum(*this));
+            return this->copy(*this);
         }
 
         std::string formatDisplayValue() override {
@@ -279,7 +279,7 @@ namespace pl::ptrn {
         }
 
         [[nodiscard]] std::shared_ptr<Pattern> clone() const override {
-            auto other =  std::make_shared<PatternBitfieldArray>(*this);
+            auto other = this->copy(*this);
             for (const auto &entry : other->m_entries)
                 entry->setParent(other->reference());
             return other;
@@ -410,7 +410,7 @@ namespace pl::ptrn {
                 evaluator->setCurrentArrayIndex(i);
 
                 auto &entry = patterns[i];
-                if (this->hasAttribute("export") || !entry->isPatternLocal() || entry->hasAttribute("export"))
+                if (this->hasAttribute(core::attr::Export) || !entry->isPatternLocal() || entry->hasAttribute(core::attr::Export))
                     fn(i, entry);
             }
         }
@@ -553,7 +553,7 @@ namespace pl::ptrn {
         }
 
         [[nodiscard]] std::shared_ptr<Pattern> clone() const override {
-            return std::unique_ptr<Pattern>(new PatternBitfield(*this));
+            return this->copy(*this);
         }
 
         [[nodiscard]] u8 getBitOffset() const override {
@@ -777,7 +777,7 @@ namespace pl::ptrn {
 
             for (auto i = start; i < end; i++) {
                 auto &pattern = patterns[i];
-                if (this->hasAttribute("export") || !pattern->isPatternLocal() || pattern->hasAttribute("export"))
+                if (this->hasAttribute(core::attr::Export) || !pattern->isPatternLocal() || pattern->hasAttribute(core::attr::Export))
                     fn(i, pattern);
             }
         }
@@ -3,8 +3,40 @@
 #include <pl/patterns/pattern.hpp>
 #include <pl/patterns/pattern_signed.hpp>
 
+#include <map>
+
 namespace pl::ptrn {
 
+    /**
+     * @brief Pointees of one type that pointers created so far point at, used to create the pointees of further pointers
+     * @note Only used for pointee types with a static layout, their patterns only depend on the address they're placed at
+     */
+    struct PointeeTable {
+        // Instance of the type the pointees are copied from
+        std::shared_ptr<Pattern> prototype;
+        // Pointees that are currently in use, indexed by their address. Other pointers get a copy of them
+        std::map<u64, std::weak_ptr<Pattern>> instances;
+
+        /**
+         * @brief Remembers the pointee at an address so further pointers to it can copy it
+         * @note Entries of pointees that got destroyed are dropped whenever the table has doubled in size since the last time
+         * @param address Address of the pointee
+         * @param pointee Pointee
+         */
+        void addInstance(u64 address, const std::shared_ptr<Pattern> &pointee) {
+            this->instances[address] = pointee;
+            if (this->instances.size() < this->pruneSize)
+                return;
+
+            std::erase_if(this->instances, [](const auto &instance) { return instance.second.expired(); });
+            this->pruneSize = std::max(MinPruneSize, this->instances.size() * 2);
+        }
+
+    private:
+        constexpr static size_t MinPruneSize = 64;
+        size_t pruneSize = MinPruneSize;
+    };
+
     class PatternPointer : public Pattern,
                            public IInlinable {
     public:
@@ -13,7 +45,13 @@ namespace pl::ptrn {
         }
 
         PatternPointer(const PatternPointer &other) : Pattern(other) {
-            this->m_pointedAt = std::shared_ptr(other.m_pointedAt->clone());
+            if (other.m_pointeeTable != nullptr) {
+                // Pointees from a table are never modified through the pointer, the copy can keep sharing it
+                this->m_pointeeTable = other.m_pointeeTable;
+                this->m_pointedAt = other.m_pointedAt;
+            } else {
+                this->m_pointedAt = std::shared_ptr(other.m_pointedAt->clone());
+            }
 
             if (other.m_pointerType) {
                 this->m_pointerType = other.m_pointerType->clone();
@@ -21,7 +59,7 @@ namespace pl::ptrn {
         }
 
         [[nodiscard]] std::shared_ptr<Pattern> clone() const override {
-            return std::unique_ptr<Pattern>(new PatternPointer(*this));
+            return this->copy(*this);
         }
 
         [[nodiscard]] core::Token::Literal getValue() const override {
@@ -31,8 +69,8 @@ namespace pl::ptrn {
         [[nodiscard]] std::string getFormattedName() const override {
             std::string output;
             if (this->getTypeName().empty()) {
-                if (this->m_pointedAt && this->m_pointedAt->getSize() > 0) {
-                    output.append(this->m_pointedAt->getFormattedName());
+                if (const auto pointee = this->getPointeeType(); pointee != nullptr && pointee->getSize() > 0) {
+                    output.append(pointee->getFormattedName());
                 } else {
                     output.append("< ??? >");
                 }
@@ -47,6 +85,10 @@ namespace pl::ptrn {
             if (this->getVisibility() == Visibility::HighlightHidden)
                 return { };
 
+            // Pointees that haven't been accessed yet are left out instead of creating them just to list them
+            if (this->m_pointedAt == nullptr)
+                return { { this->getOffset(), this } };
+
             auto children = this->m_pointedAt->getChildren();
             children.emplace_back(this->getOffset(), this);
             return children;
@@ -56,25 +98,30 @@ namespace pl::ptrn {
             if (this->getSection() == id)
                 return;
 
-            if (this->m_pointedAt != nullptr)
+            if (const auto pointee = this->getPointeeType(); pointee != nullptr && pointee->getSection() != id) {
+                this->detachPointedAtPattern();
                 this->m_pointedAt->setSection(id);
+            }
 
             Pattern::setSection(id);
         }
 
         void setLocal(bool local) override {
+            this->detachPointedAtPattern();
             this->m_pointedAt->setLocal(local);
 
             Pattern::setLocal(local);
         }
 
         void setReference(bool reference) override {
+            this->detachPointedAtPattern();
             this->m_pointedAt->setReference(reference);
 
             Pattern::setReference(reference);
         }
 
         void setPointedAtPattern(std::shared_ptr<Pattern> &&pattern) {
+            this->m_pointeeTable.reset();
             this->m_pointedAt = std::move(pattern);
             this->m_pointedAt->setVariableName(fmt::format("*({})", this->getVariableName()));
             this->m_pointedAt->setOffset(u64(this->m_pointedAtAddress));
@@ -102,13 +149,40 @@ namespace pl::ptrn {
             return this->m_pointedAtAddress;
         }
 
+        /**
+         * @brief Shares the pointee of this pointer with other pointers to the same type through a table
+         * @note An existing pointee gets added to the table. Otherwise it's copied on first access from the pointee
+         *       of another pointer to the same address, or from the table's prototype if no such pointer exists anymore
+         * @param table Table to share the pointee through
+         */
+        void setPointeeTable(std::shared_ptr<PointeeTable> table) {
+            this->m_pointeeTable = std::move(table);
+            if (this->m_pointedAt == nullptr)
+                return;
+
+            if (this->m_pointeeTable->prototype == nullptr)
+                this->m_pointeeTable->prototype = this->m_pointedAt->clone();
+
+            this->m_pointeeTable->addInstance(u64(this->m_pointedAtAddress), this->m_pointedAt);
+        }
+
+        [[nodiscard]] const std::shared_ptr<PointeeTable> &getPointeeTable() const {
+            return this->m_pointeeTable;
+        }
+
+        [[nodiscard]] bool hasPointedAtPattern() const {
+            return this->m_pointedAt != nullptr || this->m_pointeeTable != nullptr;
+        }
+
         [[nodiscard]] const std::shared_ptr<Pattern> &getPointedAtPattern() {
+            this->materializePointedAtPattern();
             return this->m_pointedAt;
         }
 
         void setColor(u32 color) override {
             Pattern::setColor(color);
-            if (this->m_pointedAt != nullptr) {
+            if (this->hasPointedAtPattern()) {
+                this->detachPointedAtPattern();
                 this->m_pointedAt->setColor(color);
             }
         }
@@ -117,6 +191,9 @@ namespace pl::ptrn {
             if (compareCommonProperties<decltype(*this)>(other)) {
                 auto otherPointer = static_cast<const PatternPointer *>(&other);
 
+                this->materializePointedAtPattern();
+                otherPointer->materializePointedAtPattern();
+
                 return otherPointer->m_pointedAtAddress == this->m_pointedAtAddress &&
                        otherPointer->m_pointerBase == this->m_pointerBase &&
                        *otherPointer->m_pointerType == *this->m_pointerType &&
@@ -129,7 +206,8 @@ namespace pl::ptrn {
             this->m_pointedAtAddress = (this->m_pointedAtAddress - this->m_pointerBase) + base;
             this->m_pointerBase = base;
 
-            if (this->m_pointedAt != nullptr) {
+            if (this->hasPointedAtPattern()) {
+                this->detachPointedAtPattern();
                 this->m_pointedAt->setOffset(u64(this->m_pointedAtAddress));
             }
         }
@@ -139,7 +217,8 @@ namespace pl::ptrn {
 
             Pattern::setEndian(endian);
 
-            if (this->m_pointedAt != nullptr) {
+            if (const auto pointee = this->getPointeeType(); pointee != nullptr && pointee->getEndian() != endian) {
+                this->detachPointedAtPattern();
                 this->m_pointedAt->setEndian(endian);
             }
         }
@@ -154,6 +233,7 @@ namespace pl::ptrn {
         }
 
         [[nodiscard]] std::string toString() override {
+            this->materializePointedAtPattern();
             auto result = this->m_pointedAt->toString();
 
             return Pattern::callUserFormatFunc(this->reference(), true).value_or(result);
@@ -171,13 +251,68 @@ namespace pl::ptrn {
         }
 
         void clearFormatCache() override {
-            this->m_pointedAt->clearFormatCache();
+            if (this->m_pointedAt != nullptr)
+                this->m_pointedAt->clearFormatCache();
 
             Pattern::clearFormatCache();
         }
 
     private:
-        std::shared_ptr<Pattern> m_pointedAt;
+        [[nodiscard]] const Pattern *getPointeeType() const {
+            if (this->m_pointedAt != nullptr)
+                return this->m_pointedAt.get();
+            else if (this->m_pointeeTable != nullptr)
+                return this->m_pointeeTable->prototype.get();
+            else
+                return nullptr;
+        }
+
+        /**
+         * @brief Creates the pointee of a pointer that only references a pointee table so far
+         * @note Not thread-safe. Patterns are only ever accessed from one thread at a time and the table is
+         *       shared between all pointers of one run, so this must not be called concurrently
+         */
+        void materializePointedAtPattern() const {
+            if (this->m_pointedAt != nullptr || this->m_pointeeTable == nullptr)
+                return;
+
+            const auto address = u64(this->m_pointedAtAddress);
+            const auto &instances = this->m_pointeeTable->instances;
+
+            std::shared_ptr<Pattern> existing;
+            if (const auto it = instances.find(address); it != instances.end())
+                existing = it->second.lock();
+
+            std::shared_ptr<Pattern> pointee;
+            if (existing != nullptr) {
+                // Copy the pointee of the other pointer so its name and parent don't show up under this pointer
+                pointee = existing->clone();
+            } else {
+                pointee = this->m_pointeeTable->prototype->clone();
+                pointee->setOffset(address);
+                this->m_pointeeTable->addInstance(address, pointee);
+            }
+
+            pointee->setVariableName(fmt::format("*({})", this->getVariableName()));
+            pointee->setParent(nullptr);
+            this->registerCopy(pointee.get());
+
+            this->m_pointedAt = std::move(pointee);
+        }
+
+        void detachPointedAtPattern() {
+            this->materializePointedAtPattern();
+            if (this->m_pointeeTable == nullptr)
+                return;
+
+            // Modifications through this pointer must not show up in the pointees of other pointers
+            this->m_pointeeTable.reset();
+            this->m_pointedAt = this->m_pointedAt->clone();
+        }
+
+    private:
+        mutable std::shared_ptr<Pattern> m_pointedAt;
+        std::shared_ptr<PointeeTable> m_pointeeTable;
         std::shared_ptr<Pattern> m_pointerType;
         i128 m_pointedAtAddress = 0;
         u64 m_pointerBase = 0;
@@ -21,7 +21,7 @@ namespace pl::ptrn {
         }
 
         [[nodiscard]] std::shared_ptr<Pattern> clone() const override {
-            auto other = std::make_shared<PatternStruct>(*this);
+            auto other = this->copy(*this);
             for (const auto &member : other->m_members)
                 member->setParent(other->reference());
 
@@ -64,7 +64,7 @@ namespace pl::ptrn {
 
             for (u64 i = start; i < patterns.size() && i < end; i++) {
                 auto &pattern = patterns[i];
-                if (this->hasAttribute("export") || !pattern->isPatternLocal() || pattern->hasAttribute("export"))
+                if (this->hasAttribute(core::attr::Export) || !pattern->isPatternLocal() || pattern->hasAttribute(core::attr::Export))
                     fn(i, pattern);
             }
         }
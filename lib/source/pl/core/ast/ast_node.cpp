@@ -1,5 +1,7 @@
 #include <pl/core/ast/ast_node.hpp>
 
+#include <pl/core/ast/ast_node_literal.hpp>
+
 #include <pl/core/evaluator.hpp>
 #include <pl/patterns/pattern.hpp>
 
@@ -19,6 +21,15 @@ namespace pl::core::ast {
         return this->clone();
     }
 
+    [[nodiscard]] std::optional<Token::Literal> ASTNode::evaluateValue(Evaluator *evaluator) const {
+        auto node = this->evaluate(evaluator);
+
+        if (auto literal = dynamic_cast<ASTNodeLiteral *>(node.get()); literal != nullptr)
+            return literal->getValue();
+        else
+            return std::nullopt;
+    }
+
     void ASTNode::createPatterns(Evaluator *evaluator, std::vector<std::shared_ptr<ptrn::Pattern>> &resultPatterns) const {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
         std::ignore = resultPatterns;
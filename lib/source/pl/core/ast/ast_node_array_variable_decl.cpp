@@ -5,6 +5,7 @@
 
 #include <pl/core/ast/ast_node_literal.hpp>
 #include <pl/core/ast/ast_node_builtin_type.hpp>
+#include <pl/core/ast/ast_node_struct.hpp>
 #include <pl/core/ast/ast_node_type_decl.hpp>
 #include <pl/core/ast/ast_node_while_statement.hpp>
 
@@ -14,6 +15,7 @@
 #include <pl/patterns/pattern_string.hpp>
 #include <pl/patterns/pattern_wide_string.hpp>
 #include <pl/patterns/pattern_array_dynamic.hpp>
+#include <pl/patterns/pattern_array_lazy.hpp>
 #include <pl/patterns/pattern_array_static.hpp>
 
 #include <limits>
@@ -91,6 +93,12 @@ namespace pl::core::ast {
                 if (auto attributable = dynamic_cast<const Attributable *>(type))
                     isStaticType = attributable->hasAttribute("static", false);
 
+                // Per-entry attributes need an actual pattern for every entry
+                if (!isStaticType && !this->hasPerEntryAttributes()) {
+                    if (auto structType = dynamic_cast<const ASTNodeStruct *>(type); structType != nullptr)
+                        isStaticType = structType->hasStaticLayout();
+                }
+
                 if (isStaticType)
                     createStaticArray(evaluator, pattern);
                 else
@@ -119,16 +127,15 @@ namespace pl::core::ast {
         if (this->m_size == nullptr)
             err::E0004.throwError("Function arrays cannot be unsized.", {}, this->getLocation());
 
-        auto sizeNode = this->m_size->evaluate(evaluator);
-        auto sizeLiteral = dynamic_cast<ASTNodeLiteral*>(sizeNode.get());
-        if (sizeLiteral == nullptr)
+        const auto sizeValue = this->m_size->evaluateValue(evaluator);
+        if (!sizeValue.has_value())
             err::E0004.throwError("Function arrays require a fixed size.", {}, this->getLocation());
 
         auto entryCount = std::visit(wolv::util::overloaded {
                 [this](const std::string &) -> i128 { err::E0006.throwError("Cannot use string to index array.", "Try using an integral type instead.", this->getLocation()); },
                 [this](const std::shared_ptr<ptrn::Pattern> &pattern) -> i128 {err::E0006.throwError(fmt::format("Cannot use custom type '{}' to index array.", pattern->getTypeName()), "Try using an integral type instead.", this->getLocation()); },
                 [](auto &&size) -> i128 { return i128(size); }
-        }, sizeLiteral->getValue());
+        }, *sizeValue);
 
         if (entryCount < 0)
             err::E0004.throwError("Array size cannot be negative.", { }, this->getLocation());
@@ -166,6 +173,10 @@ namespace pl::core::ast {
     }
 
 
+    bool ASTNodeArrayVariableDecl::hasPerEntryAttributes() const {
+        return this->getFirstAttributeByName({ "format_entries", "format_read_entries", "format_write_entries", "transform_entries" }) != nullptr;
+    }
+
     void ASTNodeArrayVariableDecl::createStaticArray(Evaluator *evaluator, std::shared_ptr<ptrn::Pattern> &outputPattern) const {
         evaluator->alignToByte();
         auto startOffset = evaluator->getReadOffset();
@@ -184,15 +195,16 @@ namespace pl::core::ast {
         i128 entryCount = 0;
 
         if (this->m_size != nullptr) {
-            auto sizeNode = this->m_size->evaluate(evaluator);
+            const auto whileStatement = dynamic_cast<ASTNodeWhileStatement *>(this->m_size.get());
+            const auto sizeValue = whileStatement == nullptr ? this->m_size->evaluateValue(evaluator) : std::nullopt;
 
-            if (auto literal = dynamic_cast<ASTNodeLiteral *>(sizeNode.get()); literal != nullptr) {
+            if (sizeValue.has_value()) {
                 entryCount = std::visit(wolv::util::overloaded {
                         [this](const std::string &) -> i128 { err::E0006.throwError("Cannot use string to index array.", "Try using an integral type instead.", this->getLocation()); },
                         [this](const std::shared_ptr<ptrn::Pattern> &pattern) -> i128 {err::E0006.throwError(fmt::format("Cannot use custom type '{}' to index array.", pattern->getTypeName()), "Try using an integral type instead.", this->getLocation()); },
                         [](auto &&size) -> i128 { return i128(size); }
-                }, literal->getValue());
-            } else if (auto whileStatement = dynamic_cast<ASTNodeWhileStatement *>(sizeNode.get())) {
+                }, *sizeValue);
+            } else if (whileStatement != nullptr) {
                 while (whileStatement->evaluateCondition(evaluator)) {
                     if (templatePattern->getSection() == ptrn::Pattern::MainSectionId)
                         if ((evaluator->getReadOffset() - evaluator->getDataBaseAddress()) > (evaluator->getDataSize()))
@@ -248,13 +260,13 @@ namespace pl::core::ast {
         }
 
         if (dynamic_cast<ptrn::PatternPadding *>(templatePattern.get())) {
-            outputPattern = std::make_unique<ptrn::PatternPadding>(evaluator, startOffset, 0, getLocation().line);
+            outputPattern = ptrn::Pattern::create<ptrn::PatternPadding>(evaluator, startOffset, 0, getLocation().line);
         } else if (dynamic_cast<ptrn::PatternCharacter *>(templatePattern.get())) {
-            outputPattern = std::make_unique<ptrn::PatternString>(evaluator, startOffset, 0, getLocation().line);
+            outputPattern = ptrn::Pattern::create<ptrn::PatternString>(evaluator, startOffset, 0, getLocation().line);
         } else if (dynamic_cast<ptrn::PatternWideCharacter *>(templatePattern.get())) {
-            outputPattern = std::make_unique<ptrn::PatternWideString>(evaluator, startOffset, 0, getLocation().line);
+            outputPattern = ptrn::Pattern::create<ptrn::PatternWideString>(evaluator, startOffset, 0, getLocation().line);
         } else {
-            auto arrayPattern = std::make_shared<ptrn::PatternArrayStatic>(evaluator, startOffset, 0, getLocation().line);
+            auto arrayPattern = ptrn::Pattern::create<ptrn::PatternArrayStatic>(evaluator, startOffset, 0, getLocation().line);
             templatePattern->setParent(arrayPattern);
             arrayPattern->setEntries(templatePattern->clone(), size_t(entryCount));
             arrayPattern->setSection(templatePattern->getSection());
@@ -283,7 +295,17 @@ namespace pl::core::ast {
         };
 
         evaluator->alignToByte();
-        auto arrayPattern = std::make_shared<ptrn::PatternArrayDynamic>(evaluator, evaluator->getReadOffset(), 0, getLocation().line);
+
+        // Per-entry attributes get applied to every entry after the array has been created, these need to exist individually
+        std::shared_ptr<ptrn::PatternArrayLazy> lazyArrayPattern;
+        std::shared_ptr<ptrn::PatternArrayDynamic> arrayPattern;
+        if (!this->hasPerEntryAttributes()) {
+            lazyArrayPattern = ptrn::Pattern::create<ptrn::PatternArrayLazy>(evaluator, evaluator->getReadOffset(), 0, getLocation().line);
+            arrayPattern = lazyArrayPattern;
+        } else {
+            arrayPattern = ptrn::Pattern::create<ptrn::PatternArrayDynamic>(evaluator, evaluator->getReadOffset(), 0, getLocation().line);
+        }
+
         arrayPattern->setVariableName(this->m_name);
         arrayPattern->setSection(evaluator->getSectionId());
 
@@ -296,7 +318,8 @@ namespace pl::core::ast {
             if (arrayPattern->getEntryCount() > 0)
                 arrayPattern->setTypeName(arrayPattern->getEntry(0)->getTypeName());
 
-            arrayPattern->setEntries(entries);
+            if (lazyArrayPattern == nullptr)
+                arrayPattern->setEntries(entries);
             arrayPattern->setSize(size);
 
             resultPattern = std::move(arrayPattern);
@@ -313,7 +336,10 @@ namespace pl::core::ast {
                 size += pattern->getSize();
                 entryIndex++;
 
-                entries.push_back(std::move(pattern));
+                if (lazyArrayPattern != nullptr)
+                    lazyArrayPattern->addEntry(pattern);
+                else
+                    entries.push_back(std::move(pattern));
 
                 evaluator->handleAbort();
             }
@@ -321,20 +347,24 @@ namespace pl::core::ast {
 
         auto discardEntries = [&](u32 count) {
             for (u32 i = 0; i < count; i++) {
-                entries.pop_back();
+                if (lazyArrayPattern != nullptr)
+                    lazyArrayPattern->removeLastEntry();
+                else
+                    entries.pop_back();
                 entryIndex--;
             }
         };
 
         if (this->m_size != nullptr) {
-            auto sizeNode = this->m_size->evaluate(evaluator);
+            const auto whileStatement = dynamic_cast<ASTNodeWhileStatement *>(this->m_size.get());
+            const auto sizeValue = whileStatement == nullptr ? this->m_size->evaluateValue(evaluator) : std::nullopt;
 
-            if (auto literal = dynamic_cast<ASTNodeLiteral *>(sizeNode.get()); literal != nullptr) {
+            if (sizeValue.has_value()) {
                 auto entryCount = std::visit(wolv::util::overloaded {
                         [this](const std::string &) -> u128 { err::E0006.throwError("Cannot use string to index array.", "Try using an integral type instead.", this->getLocation()); },
                         [this](const std::shared_ptr<ptrn::Pattern> &pattern) -> u128 {err::E0006.throwError(fmt::format("Cannot use custom type '{}' to index array.", pattern->getTypeName()), "Try using an integral type instead.", this->getLocation()); },
                         [](auto &&size) -> u128 { return u128(size); }
-                }, literal->getValue());
+                }, *sizeValue);
 
                 auto limit = evaluator->getArrayLimit();
                 if (entryCount > limit)
@@ -368,7 +398,7 @@ namespace pl::core::ast {
                         continue;
                     }
                 }
-            } else if (auto whileStatement = dynamic_cast<ASTNodeWhileStatement *>(sizeNode.get())) {
+            } else if (whileStatement != nullptr) {
                 while (whileStatement->evaluateCondition(evaluator)) {
                     auto limit = evaluator->getArrayLimit();
                     if (entryIndex > limit)
@@ -15,10 +15,11 @@
 namespace pl::core::ast {
 
     ASTNodeAttribute::ASTNodeAttribute(std::string attribute, std::vector<std::unique_ptr<ASTNode>> &&value, std::string aliasNamespaceString, std::string autoNamespace)
-        : ASTNode(), m_attribute(std::move(attribute)), m_value(std::move(value)), m_aliasNamespaceString(std::move(aliasNamespaceString)), m_autoNamespace(std::move(autoNamespace)) { }
+        : ASTNode(), m_attribute(std::move(attribute)), m_attributeId(internAttribute(m_attribute)), m_value(std::move(value)), m_aliasNamespaceString(std::move(aliasNamespaceString)), m_autoNamespace(std::move(autoNamespace)) { }
 
     ASTNodeAttribute::ASTNodeAttribute(const ASTNodeAttribute &other) : ASTNode(other) {
         this->m_attribute = other.m_attribute;
+        this->m_attributeId = other.m_attributeId;
 
         for (const auto &value : other.m_value)
             this->m_value.emplace_back(value->clone());
@@ -197,7 +198,7 @@ namespace pl::core::ast {
 
                 for (const auto& entry : child->getEntries()) {
                     for (auto &existingPattern : *currScope.scope) {
-                        if (entry->hasVariableName() && existingPattern->getVariableName() == entry->getVariableName()) {
+                        if (existingPattern->hasSameVariableName(*entry)) {
                             err::E0008.throwError(fmt::format("Cannot merge '{}' from Type '{}' into current scope. Pattern with this name already exists.", entry->getVariableName(), pattern->getTypeName()), "", node->getLocation());
                         }
                     }
@@ -311,12 +312,12 @@ namespace pl::core::ast {
 
 
             if (auto pointerPattern = dynamic_cast<ptrn::PatternPointer *>(pattern.get())) {
-                i128 pointerValue = pointerPattern->getPointedAtAddress();
+                const Token::Literal pointerValue = pointerPattern->getPointedAtAddress();
 
                 if (function->parameterCount != api::FunctionParameterCount::exactly(1))
                     err::E0009.throwError(fmt::format("Pointer base function '{}' needs to take exactly one parameter.", functionName), fmt::format("Try 'fn {}({} value)' instead", functionName, pointerPattern->getPointerType()->getTypeName()), node->getLocation());
 
-                auto result = function->func(evaluator, { pointerValue });
+                auto result = function->func(evaluator, std::span(&pointerValue, 1));
 
                 if (!result.has_value())
                     err::E0009.throwError(fmt::format("Pointer base function '{}' did not return a value.", functionName), "Try adding a 'return <value>;' statement in all code paths.", node->getLocation());
@@ -374,10 +375,10 @@ namespace pl::core::ast {
                         evaluatedArguments.push_back(literalNode->getValue());
                 }
 
-                pattern->addAttribute(attribute->getAttribute(), evaluatedArguments);
+                pattern->addAttribute(attribute->getAttributeId(), evaluatedArguments);
             }
             else
-                pattern->addAttribute(attribute->getAttribute());
+                pattern->addAttribute(attribute->getAttributeId());
         }
     }
 
@@ -50,7 +50,7 @@ namespace pl::core::ast {
         };
 
         auto position = evaluator->getBitwiseReadOffset();
-        auto arrayPattern = std::make_shared<ptrn::PatternBitfieldArray>(evaluator, position.byteOffset, position.bitOffset, 0, getLocation().line);
+        auto arrayPattern = ptrn::Pattern::create<ptrn::PatternBitfieldArray>(evaluator, position.byteOffset, position.bitOffset, 0, getLocation().line);
         arrayPattern->setVariableName(this->m_name);
         arrayPattern->setSection(evaluator->getSectionId());
         arrayPattern->setReversed(evaluator->isReadOrderReversed());
@@ -79,16 +79,17 @@ namespace pl::core::ast {
         if (this->m_size == nullptr)
             err::E0001.throwError(fmt::format("Bitfield array was created with no size."), {}, this->getLocation());
 
-        auto sizeNode = this->m_size->evaluate(evaluator);
+        const auto whileStatement = dynamic_cast<ASTNodeWhileStatement *>(this->m_size.get());
+        const auto sizeValue = whileStatement == nullptr ? this->m_size->evaluateValue(evaluator) : std::nullopt;
         std::variant<u128, ASTNodeWhileStatement *> boundsCondition;
 
-        if (auto literalNode = dynamic_cast<ASTNodeLiteral *>(sizeNode.get()); literalNode != nullptr) {
+        if (sizeValue.has_value()) {
             boundsCondition = std::visit(wolv::util::overloaded {
                     [this](const std::string &) -> u128 { err::E0006.throwError("Cannot use string to index array.", "Try using an integral type instead.", this->getLocation()); },
                     [this](const std::shared_ptr<ptrn::Pattern> &pattern) -> u128 {err::E0006.throwError(fmt::format("Cannot use custom type '{}' to index array.", pattern->getTypeName()), "Try using an integral type instead.", this->getLocation()); },
                     [](auto &&size) -> u128 { return u128(size); }
-            }, literalNode->getValue());
-        } else if (auto whileStatement = dynamic_cast<ASTNodeWhileStatement *>(sizeNode.get()); whileStatement != nullptr) {
+            }, *sizeValue);
+        } else if (whileStatement != nullptr) {
             boundsCondition = whileStatement;
         } else {
             err::E0001.throwError(fmt::format("Unexpected type of bitfield array size node."), {}, this->getLocation());
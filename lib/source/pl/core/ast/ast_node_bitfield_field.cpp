@@ -25,22 +25,21 @@ namespace pl::core::ast {
     [[nodiscard]] bool ASTNodeBitfieldField::isPadding() const { return this->getName() == "$padding$"; }
 
     [[nodiscard]] std::shared_ptr<ptrn::PatternBitfieldField> ASTNodeBitfieldField::createBitfield(Evaluator *evaluator, u64 byteOffset, u8 bitOffset, u8 bitSize) const {
-        return std::make_shared<ptrn::PatternBitfieldField>(evaluator, byteOffset, bitOffset, bitSize, getLocation().line);
+        return ptrn::Pattern::create<ptrn::PatternBitfieldField>(evaluator, byteOffset, bitOffset, bitSize, getLocation().line);
     }
 
     void ASTNodeBitfieldField::createPatterns(Evaluator *evaluator, std::vector<std::shared_ptr<ptrn::Pattern>> &resultPatterns) const {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
-        auto node = this->m_size->evaluate(evaluator);
-        auto literal = dynamic_cast<ASTNodeLiteral *>(node.get());
-        if (literal == nullptr)
+        const auto size = this->m_size->evaluateValue(evaluator);
+        if (!size.has_value())
             err::E0010.throwError("Cannot use void expression as bitfield field size.", {}, this->getLocation());
 
         u8 bitSize = std::visit(wolv::util::overloaded {
                 [this](const std::string &) -> u8 { err::E0005.throwError("Cannot use string as bitfield field size.", "Try using a integral value instead.", this->m_size->getLocation()); },
                 [this](const std::shared_ptr<ptrn::Pattern>&) -> u8 { err::E0005.throwError("Cannot use string as bitfield field size.", "Try using a integral value instead.", this->m_size->getLocation()); },
                 [](auto &&offset) -> u8 { return static_cast<u8>(offset); }
-        }, literal->getValue());
+        }, *size);
 
         auto position = evaluator->getBitwiseReadOffsetAndIncrement(bitSize);
         auto pattern = this->createBitfield(evaluator, position.byteOffset, position.bitOffset, bitSize);
@@ -57,7 +56,7 @@ namespace pl::core::ast {
 
 
     [[nodiscard]] std::shared_ptr<ptrn::PatternBitfieldField> ASTNodeBitfieldFieldSigned::createBitfield(Evaluator *evaluator, u64 byteOffset, u8 bitOffset, u8 bitSize) const {
-        return std::make_shared<ptrn::PatternBitfieldFieldSigned>(evaluator, byteOffset, bitOffset, bitSize, getLocation().line);
+        return ptrn::Pattern::create<ptrn::PatternBitfieldFieldSigned>(evaluator, byteOffset, bitOffset, bitSize, getLocation().line);
     }
 
 
@@ -79,12 +78,12 @@ namespace pl::core::ast {
     evaluator->setBitwiseReadOffset(originalPosition);
 
     if (auto *patternEnum = dynamic_cast<ptrn::PatternEnum *>(pattern.get()); patternEnum != nullptr) {
-        auto bitfieldEnum = std::make_unique<ptrn::PatternBitfieldFieldEnum>(evaluator, byteOffset, bitOffset, bitSize, getLocation().line);
+        auto bitfieldEnum = ptrn::Pattern::create<ptrn::PatternBitfieldFieldEnum>(evaluator, byteOffset, bitOffset, bitSize, getLocation().line);
         bitfieldEnum->setTypeName(patternEnum->getTypeName());
         bitfieldEnum->setEnumValues(patternEnum->getEnumValues());
         result = std::move(bitfieldEnum);
     } else if (dynamic_cast<ptrn::PatternBoolean *>(pattern.get()) != nullptr) {
-        result = std::make_shared<ptrn::PatternBitfieldFieldBoolean>(evaluator, byteOffset, bitOffset, bitSize, getLocation().line);
+        result = ptrn::Pattern::create<ptrn::PatternBitfieldFieldBoolean>(evaluator, byteOffset, bitOffset, bitSize, getLocation().line);
     } else {
         err::E0004.throwError("Bit size specifiers may only be used with unsigned, signed, bool or enum types.", {}, this->getLocation());
     }
@@ -25,21 +25,21 @@ namespace pl::core::ast {
 
         std::shared_ptr<ptrn::Pattern> pattern;
         if (Token::isUnsigned(this->m_type))
-            pattern = std::make_shared<ptrn::PatternUnsigned>(evaluator, offset, size, getLocation().line);
+            pattern = ptrn::Pattern::create<ptrn::PatternUnsigned>(evaluator, offset, size, getLocation().line);
         else if (Token::isSigned(this->m_type))
-            pattern = std::make_shared<ptrn::PatternSigned>(evaluator, offset, size, getLocation().line);
+            pattern = ptrn::Pattern::create<ptrn::PatternSigned>(evaluator, offset, size, getLocation().line);
         else if (Token::isFloatingPoint(this->m_type))
-            pattern = std::make_shared<ptrn::PatternFloat>(evaluator, offset, size, getLocation().line);
+            pattern = ptrn::Pattern::create<ptrn::PatternFloat>(evaluator, offset, size, getLocation().line);
         else if (this->m_type == Token::ValueType::Boolean)
-            pattern = std::make_shared<ptrn::PatternBoolean>(evaluator, offset, getLocation().line);
+            pattern = ptrn::Pattern::create<ptrn::PatternBoolean>(evaluator, offset, getLocation().line);
         else if (this->m_type == Token::ValueType::Character)
-            pattern = std::make_shared<ptrn::PatternCharacter>(evaluator, offset, getLocation().line);
+            pattern = ptrn::Pattern::create<ptrn::PatternCharacter>(evaluator, offset, getLocation().line);
         else if (this->m_type == Token::ValueType::Character16)
-            pattern = std::make_shared<ptrn::PatternWideCharacter>(evaluator, offset, getLocation().line);
+            pattern = ptrn::Pattern::create<ptrn::PatternWideCharacter>(evaluator, offset, getLocation().line);
         else if (this->m_type == Token::ValueType::Padding)
-            pattern = std::make_shared<ptrn::PatternPadding>(evaluator, offset, 1, getLocation().line);
+            pattern = ptrn::Pattern::create<ptrn::PatternPadding>(evaluator, offset, 1, getLocation().line);
         else if (this->m_type == Token::ValueType::String)
-            pattern = std::make_shared<ptrn::PatternString>(evaluator, offset, 0, getLocation().line);
+            pattern = ptrn::Pattern::create<ptrn::PatternString>(evaluator, offset, 0, getLocation().line);
         else if (this->m_type == Token::ValueType::CustomType) {
             std::vector<Token::Literal> params;
 
@@ -31,15 +31,15 @@ namespace pl::core::ast {
 
     }
 
-    std::unique_ptr<ASTNode> ASTNodeCast::castValue(const Token::Literal &literal, Token::ValueType type, const std::shared_ptr<ptrn::Pattern> &typePattern, Evaluator *evaluator) const {
-        return std::unique_ptr<ASTNode>(std::visit(wolv::util::overloaded {
-            [&, this](const std::shared_ptr<ptrn::Pattern> &value) -> ASTNode * {
+    Token::Literal ASTNodeCast::castValue(const Token::Literal &literal, Token::ValueType type, const std::shared_ptr<ptrn::Pattern> &typePattern, Evaluator *evaluator) const {
+        return std::visit(wolv::util::overloaded {
+            [&, this](const std::shared_ptr<ptrn::Pattern> &value) -> Token::Literal {
                 if (value->hasAttribute("transform"))
-                    return castValue(value->getValue(), type, typePattern, evaluator).release();
+                    return castValue(value->getValue(), type, typePattern, evaluator);
                 else
-                    return new ASTNodeLiteral(value->getValue());
+                    return value->getValue();
             },
-            [&, this](const std::string &value) -> ASTNode * {
+            [&, this](const std::string &value) -> Token::Literal {
                 if (Token::isUnsigned(type)) {
                     if (value.size() > sizeof(u128))
                         err::E0004.throwError(fmt::format("Cannot cast value of type 'str' of size {} to type '{}' of size {}.", value.size(), Token::getTypeName(type), Token::getTypeSize(type)), {}, this->getLocation());
@@ -47,42 +47,42 @@ namespace pl::core::ast {
                     std::memcpy(&result, value.data(), value.size());
 
                     auto endianAdjustedValue = changeEndianess(evaluator, result & hlp::bitmask(Token::getTypeSize(type) * 8), value.size(), typePattern->getEndian());
-                    return new ASTNodeLiteral(endianAdjustedValue);
+                    return endianAdjustedValue;
                 } else
                     err::E0004.throwError(fmt::format("Cannot cast value of type 'str' to type '{}'.", Token::getTypeName(type)), {}, this->getLocation());
             },
-            [&, this](auto &&value) -> ASTNode * {
+            [&, this](auto &&value) -> Token::Literal {
                 switch (type) {
                     case Token::ValueType::Unsigned8Bit:
-                        return new ASTNodeLiteral(doIntegerCast<u128, u8>(evaluator, value, typePattern));
+                        return doIntegerCast<u128, u8>(evaluator, value, typePattern);
                     case Token::ValueType::Unsigned16Bit:
-                        return new ASTNodeLiteral(doIntegerCast<u128, u16>(evaluator, value, typePattern));
+                        return doIntegerCast<u128, u16>(evaluator, value, typePattern);
                     case Token::ValueType::Unsigned32Bit:
-                        return new ASTNodeLiteral(doIntegerCast<u128, u32>(evaluator, value, typePattern));
+                        return doIntegerCast<u128, u32>(evaluator, value, typePattern);
                     case Token::ValueType::Unsigned64Bit:
-                        return new ASTNodeLiteral(doIntegerCast<u128, u64>(evaluator, value, typePattern));
+                        return doIntegerCast<u128, u64>(evaluator, value, typePattern);
                     case Token::ValueType::Unsigned128Bit:
-                        return new ASTNodeLiteral(doIntegerCast<u128, u128>(evaluator, value, typePattern));
+                        return doIntegerCast<u128, u128>(evaluator, value, typePattern);
                     case Token::ValueType::Signed8Bit:
-                        return new ASTNodeLiteral(doIntegerCast<i128, i8>(evaluator, value, typePattern));
+                        return doIntegerCast<i128, i8>(evaluator, value, typePattern);
                     case Token::ValueType::Signed16Bit:
-                        return new ASTNodeLiteral(doIntegerCast<i128, i16>(evaluator, value, typePattern));
+                        return doIntegerCast<i128, i16>(evaluator, value, typePattern);
                     case Token::ValueType::Signed32Bit:
-                        return new ASTNodeLiteral(doIntegerCast<i128, i32>(evaluator, value, typePattern));
+                        return doIntegerCast<i128, i32>(evaluator, value, typePattern);
                     case Token::ValueType::Signed64Bit:
-                        return new ASTNodeLiteral(doIntegerCast<i128, i64>(evaluator, value, typePattern));
+                        return doIntegerCast<i128, i64>(evaluator, value, typePattern);
                     case Token::ValueType::Signed128Bit:
-                        return new ASTNodeLiteral(doIntegerCast<i128, i128>(evaluator, value, typePattern));
+                        return doIntegerCast<i128, i128>(evaluator, value, typePattern);
                     case Token::ValueType::Float:
-                        return new ASTNodeLiteral(doIntegerCast<double, float>(evaluator, value, typePattern));
+                        return doIntegerCast<double, float>(evaluator, value, typePattern);
                     case Token::ValueType::Double:
-                        return new ASTNodeLiteral(doIntegerCast<double, double>(evaluator, value, typePattern));
+                        return doIntegerCast<double, double>(evaluator, value, typePattern);
                     case Token::ValueType::Character:
-                        return new ASTNodeLiteral(doIntegerCast<char, char>(evaluator, value, typePattern));
+                        return doIntegerCast<char, char>(evaluator, value, typePattern);
                     case Token::ValueType::Character16:
-                        return new ASTNodeLiteral(doIntegerCast<u128, char16_t>(evaluator, value, typePattern));
+                        return doIntegerCast<u128, char16_t>(evaluator, value, typePattern);
                     case Token::ValueType::Boolean:
-                        return new ASTNodeLiteral(doIntegerCast<bool, bool>(evaluator, value, typePattern));
+                        return doIntegerCast<bool, bool>(evaluator, value, typePattern);
                     case Token::ValueType::String:
                     {
                         std::string string(sizeof(value), '\x00');
@@ -95,14 +95,14 @@ namespace pl::core::ast {
                         if (typePattern->getEndian() != std::endian::native)
                             std::reverse(string.begin(), string.end());
 
-                        return new ASTNodeLiteral(string);
+                        return string;
                     }
                     default:
                         err::E0004.throwError(fmt::format("Cannot cast value of type '{}' to type '{}'.", typePattern->getTypeName(), Token::getTypeName(type)), {}, this->getLocation());
                 }
             },
         },
-        literal));
+        literal);
     }
 
     ASTNodeCast::ASTNodeCast(std::unique_ptr<ASTNode> &&value, std::unique_ptr<ASTNodeTypeApplication> &&type, bool reinterpret) : m_value(std::move(value)), m_type(std::move(type)), m_reinterpret(reinterpret) { }
@@ -114,6 +114,10 @@ namespace pl::core::ast {
     }
 
     [[nodiscard]] std::unique_ptr<ASTNode> ASTNodeCast::evaluate(Evaluator *evaluator) const {
+        return std::unique_ptr<ASTNode>(new ASTNodeLiteral(*this->evaluateValue(evaluator)));
+    }
+
+    [[nodiscard]] std::optional<Token::Literal> ASTNodeCast::evaluateValue(Evaluator *evaluator) const {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
         auto startOffset = evaluator->getBitwiseReadOffset();
@@ -122,11 +126,10 @@ namespace pl::core::ast {
         evaluator->pushSectionId(ptrn::Pattern::InstantiationSectionId);
         ON_SCOPE_EXIT { evaluator->popSectionId(); };
 
-        auto evaluatedValue = this->m_value->evaluate(evaluator);
+        auto evaluatedValue = this->m_value->evaluateValue(evaluator);
         auto evaluatedType  = this->m_type->getTypeDefinition(evaluator);
 
-        auto literal = dynamic_cast<ASTNodeLiteral *>(evaluatedValue.get());
-        if (literal == nullptr)
+        if (!evaluatedValue.has_value())
             err::E0004.throwError("Cannot use void expression in a cast.", {}, this->getLocation());
 
         std::vector<std::shared_ptr<ptrn::Pattern>> typePatterns;
@@ -136,7 +139,7 @@ namespace pl::core::ast {
 
         auto &typePattern = typePatterns.front();
 
-        auto value = literal->getValue();
+        auto value = std::move(*evaluatedValue);
 
         if (!m_reinterpret) {
             auto type = dynamic_cast<const ASTNodeBuiltinType *>(evaluatedType)->getType();
@@ -164,15 +167,13 @@ namespace pl::core::ast {
             }
 
             typePattern->setLocal(true);
-            auto &heap = evaluator->getHeap();
-            typePattern->setOffset(u64(heap.size()) << 32);
-            auto &data = heap.emplace_back();
-
-            data.resize(typePattern->getSize());
+            auto heapAddress = evaluator->allocateHeapCell(typePattern->getSize());
+            typePattern->setOffset(heapAddress << 32);
 
+            auto &data = evaluator->getHeap()[heapAddress];
             std::memcpy(data.data(), bytes.data(), data.size());
 
-            return std::make_unique<ASTNodeLiteral>(typePattern);
+            return typePattern;
         }
     }
 
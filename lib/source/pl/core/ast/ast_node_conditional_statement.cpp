@@ -80,16 +80,15 @@ namespace pl::core::ast {
     }
 
     [[nodiscard]] bool ASTNodeConditionalStatement::evaluateCondition(const std::unique_ptr<ASTNode> &condition, Evaluator *evaluator) const {
-        const auto node    = condition->evaluate(evaluator);
-        const auto literal = dynamic_cast<ASTNodeLiteral *>(node.get());
-        if (literal == nullptr)
+        const auto value = condition->evaluateValue(evaluator);
+        if (!value.has_value())
             err::E0010.throwError("Cannot use void expression as condition.", {}, this->getLocation());
 
         return std::visit(wolv::util::overloaded {
                 [](const std::string &value) -> bool { return !value.empty(); },
                 [this](ptrn::Pattern *const &pattern) -> bool { err::E0004.throwError(fmt::format("Cannot cast value of type '{}' to type 'bool'.", pattern->getTypeName()), {}, this->getLocation()); },
                 [](auto &&value) -> bool { return value != 0; }
-        }, literal->getValue());
+        }, *value);
     }
 
 }
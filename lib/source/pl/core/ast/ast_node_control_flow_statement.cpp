@@ -33,12 +33,11 @@ namespace pl::core::ast {
             evaluator->setCurrentControlFlowStatement(this->m_type);
             return std::nullopt;
         } else {
-            auto returnValue = this->m_rvalue->evaluate(evaluator);
-            auto literal     = dynamic_cast<ASTNodeLiteral *>(returnValue.get());
+            auto returnValue = this->m_rvalue->evaluateValue(evaluator);
 
             evaluator->setCurrentControlFlowStatement(this->m_type);
 
-            if (literal == nullptr)
+            if (!returnValue.has_value())
                 return std::nullopt;
             else {
                 return std::visit(wolv::util::overloaded {
@@ -52,7 +51,7 @@ namespace pl::core::ast {
 
                             return pattern;
                         }
-                }, literal->getValue());
+                }, *returnValue);
             }
         }
     }
@@ -6,6 +6,7 @@
 #include <pl/core/ast/ast_node_parameter_pack.hpp>
 #include <pl/core/ast/ast_node_mathematical_expression.hpp>
 #include <pl/core/ast/ast_node_literal.hpp>
+#include <pl/core/ast/ast_node_rvalue.hpp>
 
 namespace pl::core::ast {
 
@@ -24,6 +25,15 @@ namespace pl::core::ast {
     }
 
     [[nodiscard]] std::unique_ptr<ASTNode> ASTNodeFunctionCall::evaluate(Evaluator *evaluator) const {
+        auto result = this->evaluateValue(evaluator);
+
+        if (result.has_value())
+            return std::unique_ptr<ASTNode>(new ASTNodeLiteral(std::move(result.value())));
+        else
+            return std::unique_ptr<ASTNode>(new ASTNodeMathematicalExpression(nullptr, nullptr, Token::Operator::Plus));
+    }
+
+    [[nodiscard]] std::optional<Token::Literal> ASTNodeFunctionCall::evaluateValue(Evaluator *evaluator) const {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
         evaluator->pushSectionId(ptrn::Pattern::HeapSectionId);
@@ -34,43 +44,45 @@ namespace pl::core::ast {
             evaluator->popSectionId();
         };
 
-        std::vector<Token::Literal> evaluatedParams;
+        auto &evaluatedParams = evaluator->pushArgumentFrame();
+        ON_SCOPE_EXIT { evaluator->popArgumentFrame(); };
+
         for (auto &param : this->getParams()) {
-            const auto expression = param->evaluate(evaluator)->evaluate(evaluator);
+            if (auto value = param->evaluateValue(evaluator); value.has_value()) {
+                evaluatedParams.push_back(std::move(value.value()));
+                continue;
+            }
 
-            if (auto literal = dynamic_cast<ASTNodeLiteral *>(expression.get()); literal != nullptr) {
-                evaluatedParams.push_back(literal->getValue());
-            } else if (auto parameterPack = dynamic_cast<ASTNodeParameterPack *>(expression.get())) {
-                for (auto &value : parameterPack->getValues()) {
-                    evaluatedParams.push_back(value);
+            // Parameter packs don't evaluate to a single value, they get expanded into their values instead.
+            // Arguments that don't produce a value at all, like calls to functions without a return value, are dropped
+            if (dynamic_cast<ASTNodeRValue *>(param.get()) != nullptr) {
+                const auto expression = param->evaluate(evaluator);
+                if (auto parameterPack = dynamic_cast<ASTNodeParameterPack *>(expression.get()); parameterPack != nullptr) {
+                    for (auto &value : parameterPack->getValues()) {
+                        evaluatedParams.push_back(value);
+                    }
                 }
             }
         }
 
-        const auto &functionName = this->getFunctionName();
-        auto function = evaluator->findFunction(functionName);
+        return this->callFunction(evaluator, evaluatedParams);
+    }
 
-        if (!function.has_value()) {
-            if (functionName.starts_with("std::")) {
-                evaluator->getConsole().log(LogConsole::Level::Warning, "This function might be part of the standard library.\nYou can install the standard library though\nthe Content Store found under Extras -> Content Store and then\ninclude the correct file.");
-            }
+    ASTNode::FunctionResult ASTNodeFunctionCall::callFunction(Evaluator *evaluator, std::vector<Token::Literal> &evaluatedParams) const {
+        auto startOffset = evaluator->getBitwiseReadOffset();
+        ON_SCOPE_EXIT { evaluator->setBitwiseReadOffset(startOffset); };
 
-            err::E0003.throwError(fmt::format("Cannot call unknown function '{}'.", functionName), fmt::format("Try defining it first using 'fn {}() {{ }}'", functionName), this->getLocation());
-        }
+        const auto &functionName = this->getFunctionName();
+        const auto &function = this->resolveFunction(evaluator);
 
-        const auto &[min, max] = function->parameterCount;
+        const auto &[min, max] = function.parameterCount;
+        const auto &defaultParameters = function.defaultParameters;
 
         if (evaluatedParams.size() >= min && evaluatedParams.size() < max) {
-            while (true) {
-                auto remainingParams = max - evaluatedParams.size();
-                if (remainingParams <= 0)
-                    break;
-
-                auto offset = evaluatedParams.size() - min;
-                if (offset >= function->defaultParameters.size())
-                    break;
-
-                evaluatedParams.push_back(function->defaultParameters[offset]);
+            auto offset = evaluatedParams.size() - min;
+            if (offset < defaultParameters.size()) {
+                auto count = std::min<size_t>(max - evaluatedParams.size(), defaultParameters.size() - offset);
+                evaluatedParams.insert(evaluatedParams.end(), defaultParameters.begin() + offset, defaultParameters.begin() + offset + count);
             }
         }
 
@@ -97,6 +109,7 @@ namespace pl::core::ast {
                               auto &[pattern, name] = variables[i];
 
                               pattern->setVariableName(name);
+                              evaluator->variableRenamed();
                           }
                       };
 
@@ -113,16 +126,33 @@ namespace pl::core::ast {
         ON_SCOPE_EXIT {
             evaluator->setCurrentControlFlowStatement(controlFlow);
         };
-        auto result = function->func(evaluator, evaluatedParams);
 
-        if (result.has_value())
-            return std::unique_ptr<ASTNode>(new ASTNodeLiteral(std::move(result.value())));
-        else
-            return std::unique_ptr<ASTNode>(new ASTNodeMathematicalExpression(nullptr, nullptr, Token::Operator::Plus));
+        return function.func(evaluator, evaluatedParams);
+    }
+
+    const api::Function &ASTNodeFunctionCall::resolveFunction(Evaluator *evaluator) const {
+        if (this->m_function != nullptr && this->m_functionRegistryVersion == evaluator->getFunctionRegistryVersion())
+            return *this->m_function;
+
+        const auto &functionName = this->getFunctionName();
+        auto function = evaluator->getFunction(functionName);
+
+        if (function == nullptr) {
+            if (functionName.starts_with("std::")) {
+                evaluator->getConsole().log(LogConsole::Level::Warning, "This function might be part of the standard library.\nYou can install the standard library though\nthe Content Store found under Extras -> Content Store and then\ninclude the correct file.");
+            }
+
+            err::E0003.throwError(fmt::format("Cannot call unknown function '{}'.", functionName), fmt::format("Try defining it first using 'fn {}() {{ }}'", functionName), this->getLocation());
+        }
+
+        this->m_function = function;
+        this->m_functionRegistryVersion = evaluator->getFunctionRegistryVersion();
+
+        return *function;
     }
 
     ASTNode::FunctionResult ASTNodeFunctionCall::execute(Evaluator *evaluator) const {
-        (void)this->evaluate(evaluator);
+        (void)this->evaluateValue(evaluator);
 
         return {};
     }
@@ -45,16 +45,14 @@ namespace pl::core::ast {
 
         std::vector<Token::Literal> evaluatedDefaultParams;
         for (const auto &param : this->m_defaultParameters) {
-            const auto expression = param->evaluate(evaluator)->evaluate(evaluator);
-
-            if (auto literal = dynamic_cast<ASTNodeLiteral *>(expression.get()); literal != nullptr) {
-                evaluatedDefaultParams.push_back(literal->getValue());
+            if (auto value = param->evaluateValue(evaluator); value.has_value()) {
+                evaluatedDefaultParams.push_back(std::move(value.value()));
             } else {
                 err::E0009.throwError("Default value must be a literal.", {}, this->getLocation());
             }
         }
 
-        evaluator->addCustomFunction(this->m_name, paramCount, evaluatedDefaultParams, [this](Evaluator *ctx, const std::vector<Token::Literal> &params) -> std::optional<Token::Literal> {
+        api::FunctionSpanCallback function = [this](Evaluator *ctx, std::span<const Token::Literal> params) -> std::optional<Token::Literal> {
             std::vector<std::shared_ptr<ptrn::Pattern>> variables;
 
             auto startOffset = ctx->getBitwiseReadOffset();
@@ -78,6 +76,7 @@ namespace pl::core::ast {
             ON_SCOPE_EXIT {
                 for (auto &[variable, name] : originalNames) {
                     variable->setVariableName(name);
+                    ctx->variableRenamed();
                 }
             };
             for (u32 paramIndex = 0; paramIndex < this->m_params.size() && paramIndex < params.size(); paramIndex++) {
@@ -101,6 +100,7 @@ namespace pl::core::ast {
 
                     ctx->setVariable(name, params[paramIndex]);
                     variable->setVariableName(name);
+                    ctx->variableRenamed();
 
                     ctx->setCurrentControlFlowStatement(ControlFlowStatement::None);
                 }
@@ -141,7 +141,26 @@ namespace pl::core::ast {
             }
 
             return {};
-        });
+        };
+
+        if (evaluator->getExecutionEngine() == ExecutionEngine::Bytecode) {
+            if (!this->m_compiled) {
+                this->m_program = vm::compile(this);
+                this->m_compiled = true;
+            }
+
+            // Functions the VM can't handle keep running on the AST interpreter
+            if (this->m_program != nullptr) {
+                function = [this, interpretedFunction = std::move(function)](Evaluator *ctx, std::span<const Token::Literal> params) -> std::optional<Token::Literal> {
+                    if (ctx->isDebugModeEnabled() || !vm::VirtualMachine::canExecute(*this->m_program, params))
+                        return interpretedFunction(ctx, params);
+
+                    return ctx->getVirtualMachine().execute(ctx, *this->m_program, params);
+                };
+            }
+        }
+
+        evaluator->addCustomFunction(this->m_name, paramCount, evaluatedDefaultParams, function);
 
         return nullptr;
     }
@@ -39,7 +39,7 @@ namespace pl::core::ast {
             runtime.setStartAddress(evaluator->getStartAddress() + startAddress);
         }
 
-        if (runtime.executeString(source->content, source->source) != 0) {
+        if (runtime.executeString(std::string(source->content), source->source) != 0) {
             err::E0005.throwError(fmt::format("Error while processing imported type '{}'.", m_importedTypeName), "Check the imported pattern for errors.", getLocation());
         }
 
@@ -56,7 +56,7 @@ namespace pl::core::ast {
 
             result = std::move(pattern);
         } else {
-            auto structPattern = std::make_shared<ptrn::PatternStruct>(evaluator, 0x00, 0, getLocation().line);
+            auto structPattern = ptrn::Pattern::create<ptrn::PatternStruct>(evaluator, 0x00, 0, getLocation().line);
 
             u64 minPos = std::numeric_limits<u64>::max();
             u64 maxPos = std::numeric_limits<u64>::min();
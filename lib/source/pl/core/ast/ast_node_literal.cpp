@@ -7,4 +7,10 @@ namespace pl::core::ast {
 
     ASTNodeLiteral::ASTNodeLiteral(Token::Literal literal) : ASTNode(), m_literal(std::move(literal)) { }
 
+    [[nodiscard]] std::optional<Token::Literal> ASTNodeLiteral::evaluateValue(Evaluator *evaluator) const {
+        [[maybe_unused]] auto context = evaluator->updateRuntime(this);
+
+        return this->m_literal;
+    }
+
 }
\ No newline at end of file
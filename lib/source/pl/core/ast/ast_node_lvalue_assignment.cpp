@@ -24,12 +24,11 @@ namespace pl::core::ast {
     ASTNode::FunctionResult ASTNodeLValueAssignment::execute(Evaluator *evaluator) const {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
-        const auto node    = this->getRValue()->evaluate(evaluator);
-        const auto literal = dynamic_cast<ASTNodeLiteral *>(node.get());
-        if (literal == nullptr)
+        auto evaluatedValue = this->getRValue()->evaluateValue(evaluator);
+        if (!evaluatedValue.has_value())
             err::E0010.throwError("Cannot assign void expression to variable.", {}, this->getLocation());
 
-        auto value = literal->getValue();
+        auto value = std::move(*evaluatedValue);
         if (this->getLValueName() == "$")
             evaluator->setReadOffset(u64(value.toUnsigned()));
         else {
@@ -56,18 +56,21 @@ namespace pl::core::ast {
     }
 
     [[nodiscard]] std::unique_ptr<ASTNode> ASTNodeMathematicalExpression::evaluate(Evaluator *evaluator) const {
+        return std::unique_ptr<ASTNode>(new ASTNodeLiteral(*this->evaluateValue(evaluator)));
+    }
+
+    [[nodiscard]] std::optional<Token::Literal> ASTNodeMathematicalExpression::evaluateValue(Evaluator *evaluator) const {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
         if (this->getLeftOperand() == nullptr || this->getRightOperand() == nullptr)
             err::E0002.throwError("Cannot evaluate void expression", "Did you try to work with the result of a function that didn't return anything?", this->getLocation());
 
-        const auto throwInvalidOperandError = [this]() -> ASTNode * {
+        const auto throwInvalidOperandError = [this]() -> Token::Literal {
             err::E0002.throwError("Invalid operand used in mathematical expression.", { }, this->getLocation());
         };
 
-        auto leftNode  = this->getLeftOperand()->evaluate(evaluator);
-        auto leftLiteral  = dynamic_cast<ASTNodeLiteral *>(leftNode.get());
-        if (leftLiteral == nullptr)
+        const auto leftValue = this->getLeftOperand()->evaluateValue(evaluator);
+        if (!leftValue.has_value())
             throwInvalidOperandError();
 
         if (this->getOperator() == Token::Operator::BoolAnd || this->getOperator() == Token::Operator::BoolOr) {
@@ -75,73 +78,77 @@ namespace pl::core::ast {
                     [](const std::string &value) -> bool { return !value.empty(); },
                     [this](ptrn::Pattern *const &pattern) -> bool { err::E0004.throwError(fmt::format("Cannot cast value of type '{}' to type 'bool'.", pattern->getTypeName()), {}, this->getLocation()); },
                     [](auto &&value) -> bool { return value != 0; }
-            }, leftLiteral->getValue());
+            }, *leftValue);
 
             if (this->getOperator() == Token::Operator::BoolAnd && !leftBool)
-                return std::unique_ptr<ASTNode>(new ASTNodeLiteral(false));
+                return Token::Literal(false);
             if (this->getOperator() == Token::Operator::BoolOr && leftBool)
-                return std::unique_ptr<ASTNode>(new ASTNodeLiteral(true));
+                return Token::Literal(true);
         }
 
-        auto rightNode = this->getRightOperand()->evaluate(evaluator);
-        auto rightLiteral = dynamic_cast<ASTNodeLiteral *>(rightNode.get());
-        if (rightLiteral == nullptr)
+        const auto rightValue = this->getRightOperand()->evaluateValue(evaluator);
+        if (!rightValue.has_value())
             throwInvalidOperandError();
 
-        auto leftValue = leftLiteral->getValue();
-        auto rightValue = rightLiteral->getValue();
+        return this->evaluateOperator(evaluator, *leftValue, *rightValue);
+    }
+
+    [[nodiscard]] Token::Literal ASTNodeMathematicalExpression::evaluateOperator(Evaluator *evaluator, const Token::Literal &leftValue, const Token::Literal &rightValue) const {
+        const auto throwInvalidOperandError = [this]() -> Token::Literal {
+            err::E0002.throwError("Invalid operand used in mathematical expression.", { }, this->getLocation());
+        };
 
-        auto handlePatternOperations = [&, this](auto left, auto right) -> ASTNode * {
+        auto handlePatternOperations = [&, this](auto left, auto right) -> Token::Literal {
             switch (this->getOperator()) {
                 case Token::Operator::BoolEqual:
-                    return new ASTNodeLiteral(left == right);
+                    return Token::Literal(left == right);
                 case Token::Operator::BoolNotEqual:
-                    return new ASTNodeLiteral(left != right);
+                    return Token::Literal(left != right);
                 case Token::Operator::BoolGreaterThan:
-                    return new ASTNodeLiteral(left > right);
+                    return Token::Literal(left > right);
                 case Token::Operator::BoolLessThan:
-                    return new ASTNodeLiteral(left < right);
+                    return Token::Literal(left < right);
                 case Token::Operator::BoolGreaterThanOrEqual:
-                    return new ASTNodeLiteral(left >= right);
+                    return Token::Literal(left >= right);
                 case Token::Operator::BoolLessThanOrEqual:
-                    return new ASTNodeLiteral(left <= right);
+                    return Token::Literal(left <= right);
                 default:
                     return throwInvalidOperandError();
             }
         };
 
-        return std::unique_ptr<ASTNode>(std::visit(wolv::util::overloaded {
-            [&](u128 left, const std::shared_ptr<ptrn::Pattern> &right)                 -> ASTNode * { return handlePatternOperations(left, right->getValue().toUnsigned());        },
-            [&](i128 left, const std::shared_ptr<ptrn::Pattern> &right)                 -> ASTNode * { return handlePatternOperations(left, right->getValue().toSigned());          },
-            [&](double left, const std::shared_ptr<ptrn::Pattern> &right)               -> ASTNode * { return handlePatternOperations(left, right->getValue().toFloatingPoint());   },
-            [&](char left, const std::shared_ptr<ptrn::Pattern> &right)                 -> ASTNode * { return handlePatternOperations(left, right->getValue().toSigned());          },
-            [&](bool left, const std::shared_ptr<ptrn::Pattern> &right)                 -> ASTNode * { return handlePatternOperations(left, right->getValue().toBoolean());         },
-            [&](const std::string &left, const std::shared_ptr<ptrn::Pattern> &right)   -> ASTNode * { return handlePatternOperations(left, right->getValue().toString(true));      },
-            [&](const std::shared_ptr<ptrn::Pattern> &left, u128 right)                 -> ASTNode * { return handlePatternOperations(left->getValue().toUnsigned(), right);        },
-            [&](const std::shared_ptr<ptrn::Pattern> &left, i128 right)                 -> ASTNode * { return handlePatternOperations(left->getValue().toSigned(), right);          },
-            [&](const std::shared_ptr<ptrn::Pattern> &left, double right)               -> ASTNode * { return handlePatternOperations(left->getValue().toFloatingPoint(), right);   },
-            [&](const std::shared_ptr<ptrn::Pattern> &left, char right)                 -> ASTNode * { return handlePatternOperations(left->getValue().toSigned(), right);          },
-            [&](const std::shared_ptr<ptrn::Pattern> &left, bool right)                 -> ASTNode * { return handlePatternOperations(left->getValue().toBoolean(), right);         },
-            [&](const std::shared_ptr<ptrn::Pattern> &left, const std::string &right)   -> ASTNode * { return handlePatternOperations(left->getValue().toString(true), right);      },
-            [&](u128, const std::string &)                              -> ASTNode * { return throwInvalidOperandError(); },
-            [&](i128, const std::string &)                              -> ASTNode * { return throwInvalidOperandError(); },
-            [&](double, const std::string &)                            -> ASTNode * { return throwInvalidOperandError(); },
-            [&](bool, const std::string &)                              -> ASTNode * { return throwInvalidOperandError(); },
-            [&, this](const std::shared_ptr<ptrn::Pattern> &left, const std::shared_ptr<ptrn::Pattern> &right) -> ASTNode * {
+        return std::visit(wolv::util::overloaded {
+            [&](u128 left, const std::shared_ptr<ptrn::Pattern> &right)                 -> Token::Literal { return handlePatternOperations(left, right->getValue().toUnsigned());        },
+            [&](i128 left, const std::shared_ptr<ptrn::Pattern> &right)                 -> Token::Literal { return handlePatternOperations(left, right->getValue().toSigned());          },
+            [&](double left, const std::shared_ptr<ptrn::Pattern> &right)               -> Token::Literal { return handlePatternOperations(left, right->getValue().toFloatingPoint());   },
+            [&](char left, const std::shared_ptr<ptrn::Pattern> &right)                 -> Token::Literal { return handlePatternOperations(left, right->getValue().toSigned());          },
+            [&](bool left, const std::shared_ptr<ptrn::Pattern> &right)                 -> Token::Literal { return handlePatternOperations(left, right->getValue().toBoolean());         },
+            [&](const std::string &left, const std::shared_ptr<ptrn::Pattern> &right)   -> Token::Literal { return handlePatternOperations(left, right->getValue().toString(true));      },
+            [&](const std::shared_ptr<ptrn::Pattern> &left, u128 right)                 -> Token::Literal { return handlePatternOperations(left->getValue().toUnsigned(), right);        },
+            [&](const std::shared_ptr<ptrn::Pattern> &left, i128 right)                 -> Token::Literal { return handlePatternOperations(left->getValue().toSigned(), right);          },
+            [&](const std::shared_ptr<ptrn::Pattern> &left, double right)               -> Token::Literal { return handlePatternOperations(left->getValue().toFloatingPoint(), right);   },
+            [&](const std::shared_ptr<ptrn::Pattern> &left, char right)                 -> Token::Literal { return handlePatternOperations(left->getValue().toSigned(), right);          },
+            [&](const std::shared_ptr<ptrn::Pattern> &left, bool right)                 -> Token::Literal { return handlePatternOperations(left->getValue().toBoolean(), right);         },
+            [&](const std::shared_ptr<ptrn::Pattern> &left, const std::string &right)   -> Token::Literal { return handlePatternOperations(left->getValue().toString(true), right);      },
+            [&](u128, const std::string &)                              -> Token::Literal { return throwInvalidOperandError(); },
+            [&](i128, const std::string &)                              -> Token::Literal { return throwInvalidOperandError(); },
+            [&](double, const std::string &)                            -> Token::Literal { return throwInvalidOperandError(); },
+            [&](bool, const std::string &)                              -> Token::Literal { return throwInvalidOperandError(); },
+            [&, this](const std::shared_ptr<ptrn::Pattern> &left, const std::shared_ptr<ptrn::Pattern> &right) -> Token::Literal {
                 std::vector<u8> leftBytes(left->getSize()), rightBytes(right->getSize());
 
                 evaluator->readData(left->getOffset(), leftBytes.data(), leftBytes.size(), left->getSection());
                 evaluator->readData(right->getOffset(), rightBytes.data(), rightBytes.size(), right->getSection());
                 switch (this->getOperator()) {
                    case Token::Operator::BoolEqual:
-                       return new ASTNodeLiteral(leftBytes == rightBytes);
+                       return Token::Literal(leftBytes == rightBytes);
                    case Token::Operator::BoolNotEqual:
-                       return new ASTNodeLiteral(leftBytes != rightBytes);
+                       return Token::Literal(leftBytes != rightBytes);
                    default:
                        return throwInvalidOperandError();
                 }
             },
-            [&, this](const std::string &left, auto right) -> ASTNode * {
+            [&, this](const std::string &left, auto right) -> Token::Literal {
                 switch (this->getOperator()) {
                    case Token::Operator::Star:
                    {
@@ -151,112 +158,112 @@ namespace pl::core::ast {
                        std::string result;
                        for (u128 i = 0; i < static_cast<u128>(right); i++)
                            result += left;
-                       return new ASTNodeLiteral(result);
+                       return Token::Literal(result);
                    }
                    default:
                        return throwInvalidOperandError();
                 }
             },
-            [&, this](const std::string &left, const std::string &right) -> ASTNode * {
+            [&, this](const std::string &left, const std::string &right) -> Token::Literal {
                 switch (this->getOperator()) {
                    case Token::Operator::Plus:
-                       return new ASTNodeLiteral(left + right);
+                       return Token::Literal(left + right);
                    case Token::Operator::BoolEqual:
-                       return new ASTNodeLiteral(left == right);
+                       return Token::Literal(left == right);
                    case Token::Operator::BoolNotEqual:
-                       return new ASTNodeLiteral(left != right);
+                       return Token::Literal(left != right);
                    case Token::Operator::BoolGreaterThan:
-                       return new ASTNodeLiteral(left > right);
+                       return Token::Literal(left > right);
                    case Token::Operator::BoolLessThan:
-                       return new ASTNodeLiteral(left < right);
+                       return Token::Literal(left < right);
                    case Token::Operator::BoolGreaterThanOrEqual:
-                       return new ASTNodeLiteral(left >= right);
+                       return Token::Literal(left >= right);
                    case Token::Operator::BoolLessThanOrEqual:
-                       return new ASTNodeLiteral(left <= right);
+                       return Token::Literal(left <= right);
                    default:
                        return throwInvalidOperandError();
                 }
             },
-            [&, this](const std::string &left, char right) -> ASTNode * {
+            [&, this](const std::string &left, char right) -> Token::Literal {
                 switch (this->getOperator()) {
                    case Token::Operator::Plus:
-                       return new ASTNodeLiteral(left + right);
+                       return Token::Literal(left + right);
                    default:
                        return throwInvalidOperandError();
                 }
             },
-            [&, this](char left, const std::string &right) -> ASTNode * {
+            [&, this](char left, const std::string &right) -> Token::Literal {
                 switch (this->getOperator()) {
                    case Token::Operator::Plus:
-                       return new ASTNodeLiteral(left + right);
+                       return Token::Literal(left + right);
                    default:
                        return throwInvalidOperandError();
                 }
             },
-            [&, this](auto left, auto right) -> ASTNode * {
+            [&, this](auto left, auto right) -> Token::Literal {
                 using RBase = std::common_type_t<decltype(left), decltype(right)>;
                 using R = std::conditional_t<std::same_as<RBase, int>, i128, RBase>;
 
                 switch (this->getOperator()) {
                    case Token::Operator::Plus:
-                        return new ASTNodeLiteral(R(R(left) + R(right)));
+                        return Token::Literal(R(R(left) + R(right)));
                    case Token::Operator::Minus:
-                        return new ASTNodeLiteral(R(R(left) - R(right)));
+                        return Token::Literal(R(R(left) - R(right)));
                    case Token::Operator::Star:
-                        return new ASTNodeLiteral(R(R(left) * R(right)));
+                        return Token::Literal(R(R(left) * R(right)));
                    case Token::Operator::Slash:
                        if (right == 0)
                            err::E0002.throwError("Division by zero.", { }, this->getLocation());
                        if constexpr (std::same_as<R, bool>)
 						   err::E0001.throwError("Cannot divide boolean values.", { }, this->getLocation());
                        else
-                           return new ASTNodeLiteral(R(R(left) / R(right)));
+                           return Token::Literal(R(R(left) / R(right)));
                    case Token::Operator::Percent:
                        if (right == 0)
                            err::E0002.throwError("Division by zero.", { }, this->getLocation());
                        if constexpr (std::same_as<R, bool>)
                            err::E0001.throwError("Cannot divide boolean values.", { }, this->getLocation());
                        else
-                           return new ASTNodeLiteral(R(modulus(left, right)));
+                           return Token::Literal(R(modulus(left, right)));
                    case Token::Operator::LeftShift:
-                       return new ASTNodeLiteral(R(shiftLeft(left, right)));
+                       return Token::Literal(R(shiftLeft(left, right)));
                    case Token::Operator::RightShift:
-                       return new ASTNodeLiteral(R(shiftRight(left, right)));
+                       return Token::Literal(R(shiftRight(left, right)));
                    case Token::Operator::BitAnd:
-                       return new ASTNodeLiteral(R(bitAnd(left, right)));
+                       return Token::Literal(R(bitAnd(left, right)));
                    case Token::Operator::BitXor:
-                       return new ASTNodeLiteral(R(bitXor(left, right)));
+                       return Token::Literal(R(bitXor(left, right)));
                    case Token::Operator::BitOr:
-                       return new ASTNodeLiteral(R(bitOr(left, right)));
+                       return Token::Literal(R(bitOr(left, right)));
                    case Token::Operator::BitNot:
-                       return new ASTNodeLiteral(R(bitNot(left, right)));
+                       return Token::Literal(R(bitNot(left, right)));
                    case Token::Operator::BoolEqual:
-                       return new ASTNodeLiteral(bool(left == static_cast<decltype(left)>(right)));
+                       return Token::Literal(bool(left == static_cast<decltype(left)>(right)));
                    case Token::Operator::BoolNotEqual:
-                       return new ASTNodeLiteral(bool(left != static_cast<decltype(left)>(right)));
+                       return Token::Literal(bool(left != static_cast<decltype(left)>(right)));
                    case Token::Operator::BoolGreaterThan:
-                       return new ASTNodeLiteral(bool(left > static_cast<decltype(left)>(right)));
+                       return Token::Literal(bool(left > static_cast<decltype(left)>(right)));
                    case Token::Operator::BoolLessThan:
-                       return new ASTNodeLiteral(bool(left < static_cast<decltype(left)>(right)));
+                       return Token::Literal(bool(left < static_cast<decltype(left)>(right)));
                    case Token::Operator::BoolGreaterThanOrEqual:
-                       return new ASTNodeLiteral(bool(left >= static_cast<decltype(left)>(right)));
+                       return Token::Literal(bool(left >= static_cast<decltype(left)>(right)));
                    case Token::Operator::BoolLessThanOrEqual:
-                       return new ASTNodeLiteral(bool(left <= static_cast<decltype(left)>(right)));
+                       return Token::Literal(bool(left <= static_cast<decltype(left)>(right)));
                    case Token::Operator::BoolAnd:
-                       return new ASTNodeLiteral(bool(left && right));
+                       return Token::Literal(bool(left && right));
                    case Token::Operator::BoolXor:
-                       return new ASTNodeLiteral(bool((left && !right) || (!left && right)));
+                       return Token::Literal(bool((left && !right) || (!left && right)));
                    case Token::Operator::BoolOr:
-                       return new ASTNodeLiteral(bool(left || right));
+                       return Token::Literal(bool(left || right));
                    case Token::Operator::BoolNot:
-                       return new ASTNodeLiteral(bool(!right));
+                       return Token::Literal(bool(!right));
                    default:
                        return throwInvalidOperandError();
                 }
             }
         },
         leftValue,
-        rightValue));
+        rightValue);
     }
 
 }
\ No newline at end of file
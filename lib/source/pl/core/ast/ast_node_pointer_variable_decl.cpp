@@ -5,6 +5,7 @@
 
 #include <pl/core/ast/ast_node_type_decl.hpp>
 #include <pl/core/ast/ast_node_literal.hpp>
+#include <pl/core/ast/ast_node_struct.hpp>
 
 #include <pl/patterns/pattern_pointer.hpp>
 
@@ -72,12 +73,12 @@ namespace pl::core::ast {
         auto &sizePattern = sizePatterns.front();
         sizePattern->setSection(evaluator->getSectionId());
 
-        auto pattern = std::make_shared<ptrn::PatternPointer>(evaluator, pointerStartOffset, sizePattern->getSize(), getLocation().line);
+        auto pattern = ptrn::Pattern::create<ptrn::PatternPointer>(evaluator, pointerStartOffset, sizePattern->getSize(), getLocation().line);
         pattern->setVariableName(this->m_name);
         pattern->setPointerTypePattern(std::move(sizePattern));
 
         ON_SCOPE_EXIT {
-            if (pattern->getPointedAtPattern() != nullptr)
+            if (pattern->hasPointedAtPattern())
                 resultPatterns = hlp::moveToVector<std::shared_ptr<ptrn::Pattern>>(std::move(pattern));
         };
 
@@ -91,21 +92,30 @@ namespace pl::core::ast {
             pattern->setPointedAtAddress(pointerAddress);
             applyVariableAttributes(evaluator, this, pattern);
 
-            evaluator->setReadOffset(u64(pattern->getPointedAtAddress()));
+            const auto pointeeTable = this->getPointeeTable(evaluator, pattern);
+            if (pointeeTable != nullptr && this->canDeferPointee(evaluator, *pointeeTable, u64(pattern->getPointedAtAddress()))) {
+                pattern->setPointeeTable(pointeeTable);
+                pattern->setSection(evaluator->getSectionId());
+            } else {
+                evaluator->setReadOffset(u64(pattern->getPointedAtAddress()));
 
-            std::vector<std::shared_ptr<ptrn::Pattern>> pointedAtPatterns;
-            ON_SCOPE_EXIT {
-                if (!pointedAtPatterns.empty()) {
-                    auto &pointedAtPattern = pointedAtPatterns.front();
-                    pattern->setPointedAtPattern(std::move(pointedAtPattern));
-                }
+                std::vector<std::shared_ptr<ptrn::Pattern>> pointedAtPatterns;
+                ON_SCOPE_EXIT {
+                    if (!pointedAtPatterns.empty()) {
+                        auto &pointedAtPattern = pointedAtPatterns.front();
+                        pattern->setPointedAtPattern(std::move(pointedAtPattern));
 
-                pattern->setSection(evaluator->getSectionId());
-            };
+                        if (pointeeTable != nullptr && std::uncaught_exceptions() == 0)
+                            pattern->setPointeeTable(pointeeTable);
+                    }
 
-            this->m_type->createPatterns(evaluator, pointedAtPatterns);
-            if (pointedAtPatterns.empty())
-                err::E0005.throwError("'auto' can only be used with parameters.", { }, this->getLocation());
+                    pattern->setSection(evaluator->getSectionId());
+                };
+
+                this->m_type->createPatterns(evaluator, pointedAtPatterns);
+                if (pointedAtPatterns.empty())
+                    err::E0005.throwError("'auto' can only be used with parameters.", { }, this->getLocation());
+            }
         }
 
         if (this->m_placementSection != nullptr)
@@ -129,4 +139,33 @@ namespace pl::core::ast {
         }
     }
 
+    std::shared_ptr<ptrn::PointeeTable> ASTNodePointerVariableDecl::getPointeeTable(Evaluator *evaluator, const std::shared_ptr<ptrn::PatternPointer> &pattern) const {
+        // Pointees of other types depend on more than their address, these need to be evaluated for every pointer
+        if (!ASTNodeStruct::isStaticType(this->m_type.get()))
+            return nullptr;
+
+        // A pointer coloring its pointee needs its own copy of it
+        if (pattern->hasOverriddenColor())
+            return nullptr;
+
+        // Pointers to the same type share their pointees unless the endianness is overridden in the declaration
+        const ASTNode *type = this->m_type.get();
+        if (auto typeApplication = dynamic_cast<const ASTNodeTypeApplication *>(type); typeApplication != nullptr && !typeApplication->getEndian().has_value())
+            type = typeApplication->getType().get();
+
+        return evaluator->getPointeeTable(type);
+    }
+
+    bool ASTNodePointerVariableDecl::canDeferPointee(Evaluator *evaluator, const ptrn::PointeeTable &table, u64 address) const {
+        // Another pointer already points at the same address, its pointee can be copied
+        if (const auto it = table.instances.find(address); it != table.instances.end() && !it->second.expired())
+            return true;
+
+        // Otherwise the pointee can only be created later once the type has been evaluated at least once
+        if (table.prototype == nullptr)
+            return false;
+
+        return evaluator->areLazyPointersEnabled() || this->hasAttribute("lazy", false);
+    }
+
 }
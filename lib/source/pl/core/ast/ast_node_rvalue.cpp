@@ -55,26 +55,39 @@ namespace pl::core::ast {
 
         if (this->getPath().size() == 1) {
             if (auto name = std::get_if<std::string>(&this->getPath().front()); name != nullptr) {
-                if (*name == "$") return std::make_unique<ASTNodeLiteral>(u128(evaluator->getReadOffset()));
-                else if (*name == "null") return std::make_unique<ASTNodeLiteral>(
-                    std::make_shared<ptrn::PatternPadding>(evaluator, 0, 0, getLocation().line));
-
                 auto parameterPack = evaluator->getScope(0).parameterPack;
                 if (parameterPack && *name == parameterPack->name)
                     return std::make_unique<ASTNodeParameterPack>(std::move(parameterPack->values));
             }
+        }
+
+        return std::unique_ptr<ASTNode>(new ASTNodeLiteral(*this->evaluateValue(evaluator)));
+    }
+
+    [[nodiscard]] std::optional<Token::Literal> ASTNodeRValue::evaluateValue(Evaluator *evaluator) const {
+        [[maybe_unused]] auto context = evaluator->updateRuntime(this);
+
+        if (this->getPath().size() == 1) {
+            if (auto name = std::get_if<std::string>(&this->getPath().front()); name != nullptr) {
+                if (*name == "$") return u128(evaluator->getReadOffset());
+                else if (*name == "null") return ptrn::Pattern::create<ptrn::PatternPadding>(evaluator, 0, 0, getLocation().line);
+
+                // Parameter packs don't evaluate to a single value
+                auto parameterPack = evaluator->getScope(0).parameterPack;
+                if (parameterPack && *name == parameterPack->name)
+                    return std::nullopt;
+            }
         } else if (this->getPath().size() == 2) {
             if (auto name = std::get_if<std::string>(this->getPath().data()); name != nullptr) {
                 if (*name == "$") {
                     if (auto arraySegment = std::get_if<std::unique_ptr<ASTNode>>(&this->getPath()[1]); arraySegment != nullptr) {
-                        auto offsetNode = (*arraySegment)->evaluate(evaluator);
-                        auto offsetLiteral = dynamic_cast<ASTNodeLiteral*>(offsetNode.get());
-                        if (offsetLiteral != nullptr) {
-                            auto offset = u64(offsetLiteral->getValue().toUnsigned());
+                        auto offsetValue = (*arraySegment)->evaluateValue(evaluator);
+                        if (offsetValue.has_value()) {
+                            auto offset = u64(offsetValue->toUnsigned());
 
                             u8 byte = 0x00;
                             evaluator->readData(offset, &byte, 1, ptrn::Pattern::MainSectionId);
-                            return std::make_unique<ASTNodeLiteral>(u128(byte));
+                            return u128(byte);
                         }
                     }
                 }
@@ -138,17 +151,18 @@ namespace pl::core::ast {
             literal = pattern;
         }
 
-        if (auto transformFunc = evaluator->findFunction(pattern->getTransformFunction()); transformFunc.has_value()) {
+        if (auto transformFunc = evaluator->getFunction(pattern->getTransformFunction()); transformFunc != nullptr) {
             auto oldPatternName = pattern->getVariableName();
-            auto result = transformFunc->func(evaluator, { std::move(literal) });
+            auto result = transformFunc->func(evaluator, std::span(&literal, 1));
             pattern->setVariableName(oldPatternName);
+            evaluator->variableRenamed();
 
             if (!result.has_value())
                 err::E0009.throwError("Transform function did not return a value.", "Try adding a 'return <value>;' statement in all code paths.", this->getLocation());
             literal = std::move(result.value());
         }
 
-        return std::unique_ptr<ASTNode>(new ASTNodeLiteral(std::move(literal)));
+        return literal;
     }
 
     void ASTNodeRValue::createPatterns(Evaluator *evaluator, std::vector<std::shared_ptr<ptrn::Pattern>> &resultPatterns) const {
@@ -199,22 +213,24 @@ namespace pl::core::ast {
                     if (currPattern == nullptr) {
                         const auto findInScope = [&name](const std::vector<std::shared_ptr<ptrn::Pattern>> &scope) -> std::shared_ptr<ptrn::Pattern> {
                             for (const auto & iter : std::views::reverse(scope)) {
-                                if (iter->getVariableName() == name)
+                                if (iter->hasVariableName(name))
                                     return iter;
                             }
 
                             return nullptr;
                         };
 
-                        pattern = findInScope(*evaluator->getScope(0).scope);
+                        if (auto variable = evaluator->getScope(0).findVariable(name); variable != nullptr)
+                            pattern = *variable;
                         if (pattern == nullptr)
                             pattern = findInScope(evaluator->getTemplateParameters());
-                        if (pattern == nullptr && !evaluator->isGlobalScope())
-                            pattern = findInScope(*evaluator->getGlobalScope().scope);
+                        if (pattern == nullptr && !evaluator->isGlobalScope()) {
+                            if (auto variable = evaluator->getGlobalScope().findVariable(name); variable != nullptr)
+                                pattern = *variable;
+                        }
                     } else if (auto currParent = evaluator->getScope(scopeIndex).parent; currParent == currPattern) {
-                        auto view = *evaluator->getScope(scopeIndex).scope | std::views::reverse;
-                        if (auto result = find(view, name, &ptrn::Pattern::getVariableName); result != view.end())
-                            pattern = *result;
+                        if (auto variable = evaluator->getScope(scopeIndex).findVariable(name); variable != nullptr)
+                            pattern = *variable;
                     } else if (auto indexablePattern = dynamic_cast<ptrn::IIndexable *>(currPattern.get()); indexablePattern != nullptr) {
                         auto iota_view = std::views::iota(std::size_t(0), indexablePattern->getEntryCount());
                         auto view = iota_view | std::views::transform(std::bind_front(&ptrn::IIndexable::getEntry, indexablePattern)) | std::views::reverse;
@@ -239,9 +255,8 @@ namespace pl::core::ast {
                 }
             } else {
                 // Array indexing
-                auto node  = std::get<std::unique_ptr<ASTNode>>(part)->evaluate(evaluator);
-                auto index = dynamic_cast<ASTNodeLiteral *>(node.get());
-                if (index == nullptr)
+                const auto index = std::get<std::unique_ptr<ASTNode>>(part)->evaluateValue(evaluator);
+                if (!index.has_value())
                     err::E0010.throwError("Cannot use void expression as array index.", {}, this->getLocation());
 
                 std::visit(wolv::util::overloaded {
@@ -258,7 +273,7 @@ namespace pl::core::ast {
                                        }
                                    }
                            },
-                           index->getValue()
+                           *index
                 );
             }
 
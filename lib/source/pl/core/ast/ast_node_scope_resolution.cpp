@@ -18,13 +18,17 @@ namespace pl::core::ast {
 
 
     [[nodiscard]] std::unique_ptr<ASTNode> ASTNodeScopeResolution::evaluate(Evaluator *evaluator) const {
+        return std::unique_ptr<ASTNode>(new ASTNodeLiteral(*this->evaluateValue(evaluator)));
+    }
+
+    [[nodiscard]] std::optional<Token::Literal> ASTNodeScopeResolution::evaluateValue(Evaluator *evaluator) const {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
         auto type = this->m_type->getTypeDefinition(evaluator);
 
         if (auto enumType = dynamic_cast<const ASTNodeEnum *>(type)) {
             const auto &[min, max] = enumType->getEnumValue(evaluator, m_name);
-            return std::make_unique<ASTNodeLiteral>(min);
+            return min;
         } else {
             err::E0004.throwError("Invalid scope resolution. This cannot be accessed using the scope resolution operator.", {}, this->getLocation());
         }
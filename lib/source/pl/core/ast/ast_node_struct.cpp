@@ -3,10 +3,58 @@
 #include <pl/core/evaluator.hpp>
 #include <pl/patterns/pattern.hpp>
 
+#include <pl/core/ast/ast_node_array_variable_decl.hpp>
+#include <pl/core/ast/ast_node_builtin_type.hpp>
+#include <pl/core/ast/ast_node_enum.hpp>
+#include <pl/core/ast/ast_node_literal.hpp>
+#include <pl/core/ast/ast_node_multi_variable_decl.hpp>
+#include <pl/core/ast/ast_node_type_decl.hpp>
+#include <pl/core/ast/ast_node_variable_decl.hpp>
+
 #include <pl/patterns/pattern_struct.hpp>
 
+#include <algorithm>
+
 namespace pl::core::ast {
 
+    namespace {
+
+        bool hasConstantAttributes(const Attributable *attributable) {
+            for (const auto &attribute : attributable->getAttributes()) {
+                for (const auto &argument : attribute->getArguments()) {
+                    if (dynamic_cast<const ASTNodeLiteral *>(argument.get()) == nullptr)
+                        return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool isStaticMember(const ASTNode *member) {
+            if (auto variableDecl = dynamic_cast<const ASTNodeVariableDecl *>(member); variableDecl != nullptr) {
+                return variableDecl->getPlacementOffset() == nullptr &&
+                       variableDecl->getPlacementSection() == nullptr &&
+                       !variableDecl->isInVariable() && !variableDecl->isOutVariable() &&
+                       hasConstantAttributes(variableDecl) &&
+                       ASTNodeStruct::isStaticType(variableDecl->getType().get());
+            } else if (auto arrayDecl = dynamic_cast<const ASTNodeArrayVariableDecl *>(member); arrayDecl != nullptr) {
+                const auto size = dynamic_cast<const ASTNodeLiteral *>(arrayDecl->getSize().get());
+
+                return size != nullptr && !size->getValue().isString() && !size->getValue().isPattern() &&
+                       arrayDecl->getPlacementOffset() == nullptr &&
+                       arrayDecl->getPlacementSection() == nullptr &&
+                       hasConstantAttributes(arrayDecl) &&
+                       ASTNodeStruct::isStaticType(arrayDecl->getType().get());
+            } else if (auto multiVariableDecl = dynamic_cast<const ASTNodeMultiVariableDecl *>(member); multiVariableDecl != nullptr) {
+                return std::ranges::all_of(multiVariableDecl->getVariables(), [](const auto &variable) { return isStaticMember(variable.get()); });
+            }
+
+            // Anything else might depend on the data or have side effects
+            return false;
+        }
+
+    }
+
     ASTNodeStruct::ASTNodeStruct(const ASTNodeStruct &other) : ASTNode(other), Attributable(other) {
         for (const auto &otherMember : other.getMembers())
             this->m_members.push_back(otherMember->clone());
@@ -18,7 +66,16 @@ namespace pl::core::ast {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
         evaluator->alignToByte();
-        auto pattern = std::make_shared<ptrn::PatternStruct>(evaluator, evaluator->getReadOffset(), 0, getLocation().line);
+
+        const bool staticLayout = this->hasStaticLayout();
+        if (staticLayout) {
+            if (auto cachedPattern = evaluator->instantiateCachedTypeLayout(this); cachedPattern != nullptr) {
+                resultPatterns = hlp::moveToVector<std::shared_ptr<ptrn::Pattern>>(std::move(cachedPattern));
+                return;
+            }
+        }
+
+        auto pattern = ptrn::Pattern::create<ptrn::PatternStruct>(evaluator, evaluator->getReadOffset(), 0, getLocation().line);
 
         auto startOffset = evaluator->getReadOffset();
         std::vector<std::shared_ptr<ptrn::Pattern>> memberPatterns;
@@ -36,6 +93,9 @@ namespace pl::core::ast {
 
             resultPatterns = hlp::moveToVector<std::shared_ptr<ptrn::Pattern>>(std::move(pattern));
 
+            if (staticLayout && std::uncaught_exceptions() == 0)
+                evaluator->cacheTypeLayout(this, resultPatterns.front());
+
             evaluator->popScope();
             evaluator->alignToByte();
         };
@@ -77,7 +137,7 @@ namespace pl::core::ast {
                     continue;
 
                 for (auto &existingPattern : memberPatterns) {
-                    if (existingPattern->getVariableName() == varName) {
+                    if (existingPattern->hasSameVariableName(*memberPattern)) {
                         err::E0003.throwError(fmt::format("Redeclaration of identifier '{}'.", existingPattern->getVariableName()), "", member->getLocation());
                     }
                 }
@@ -99,4 +159,52 @@ namespace pl::core::ast {
         }
     }
 
-}
\ No newline at end of file
+    bool ASTNodeStruct::hasStaticLayout() const {
+        if (this->m_staticLayout.has_value())
+            return *this->m_staticLayout;
+
+        // Assume a dynamic layout while analyzing to terminate on recursive types
+        this->m_staticLayout = false;
+
+        const bool staticLayout = !this->m_members.empty() &&
+                                  hasConstantAttributes(this) &&
+                                  std::ranges::all_of(this->m_inheritance, [](const auto &type) { return ASTNodeStruct::isStaticType(type.get()); }) &&
+                                  std::ranges::all_of(this->m_members, [](const auto &member) { return isStaticMember(member.get()); });
+
+        this->m_staticLayout = staticLayout;
+        return staticLayout;
+    }
+
+    bool ASTNodeStruct::isStaticType(const ASTNode *type) {
+        if (auto typeApplication = dynamic_cast<const ASTNodeTypeApplication *>(type); typeApplication != nullptr) {
+            if (typeApplication->getType() == nullptr || typeApplication->isReference() || !typeApplication->getTemplateArguments().empty())
+                return false;
+
+            return isStaticType(typeApplication->getType().get());
+        } else if (auto typeDecl = dynamic_cast<const ASTNodeTypeDecl *>(type); typeDecl != nullptr) {
+            if (!typeDecl->isValid() || typeDecl->isTemplateType() || !hasConstantAttributes(typeDecl))
+                return false;
+
+            return isStaticType(typeDecl->getType().get());
+        } else if (auto builtinType = dynamic_cast<const ASTNodeBuiltinType *>(type); builtinType != nullptr) {
+            using enum Token::ValueType;
+            switch (builtinType->getType()) {
+                case Unsigned8Bit: case Unsigned16Bit: case Unsigned24Bit: case Unsigned32Bit:
+                case Unsigned48Bit: case Unsigned64Bit: case Unsigned96Bit: case Unsigned128Bit:
+                case Signed8Bit: case Signed16Bit: case Signed24Bit: case Signed32Bit:
+                case Signed48Bit: case Signed64Bit: case Signed96Bit: case Signed128Bit:
+                case Float: case Double: case Boolean: case Character: case Character16: case Padding:
+                    return true;
+                default:
+                    return false;
+            }
+        } else if (auto enumType = dynamic_cast<const ASTNodeEnum *>(type); enumType != nullptr) {
+            return hasConstantAttributes(enumType) && isStaticType(enumType->getUnderlyingType().get());
+        } else if (auto structType = dynamic_cast<const ASTNodeStruct *>(type); structType != nullptr) {
+            return structType->hasStaticLayout();
+        }
+
+        return false;
+    }
+
+}
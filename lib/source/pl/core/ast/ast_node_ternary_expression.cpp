@@ -17,30 +17,40 @@ namespace pl::core::ast {
         this->m_third    = other.m_third->clone();
     }
 
-    [[nodiscard]] std::unique_ptr<ASTNode> ASTNodeTernaryExpression::evaluate(Evaluator *evaluator) const {
-        [[maybe_unused]] auto context = evaluator->updateRuntime(this);
-
+    [[nodiscard]] bool ASTNodeTernaryExpression::evaluateCondition(Evaluator *evaluator) const {
         if (this->getFirstOperand() == nullptr || this->getSecondOperand() == nullptr || this->getThirdOperand() == nullptr)
             err::E0002.throwError("Void expression used in ternary expression.", "If you used a function for one of the operands, make sure it returned a value.", this->getLocation());
 
-        auto conditionNode  = this->getFirstOperand()->evaluate(evaluator);
-
-        auto *conditionValue  = dynamic_cast<ASTNodeLiteral *>(conditionNode.get());
+        const auto conditionValue = this->getFirstOperand()->evaluateValue(evaluator);
 
-        if (conditionValue == nullptr)
+        if (!conditionValue.has_value())
             err::E0010.throwError("Cannot use void expression in ternary expression.", {}, this->getLocation());
 
-        auto condition = std::visit(wolv::util::overloaded {
+        return std::visit(wolv::util::overloaded {
                 [](const std::string &value) -> bool { return !value.empty(); },
                 [this](const std::shared_ptr<ptrn::Pattern> &pattern) -> bool { err::E0002.throwError(fmt::format("Cannot cast {} to bool.", pattern->getTypeName()), {}, this->getLocation()); },
                 [](auto &&value) -> bool { return bool(value); }
-        }, conditionValue->getValue());
+        }, *conditionValue);
+    }
+
+    [[nodiscard]] std::unique_ptr<ASTNode> ASTNodeTernaryExpression::evaluate(Evaluator *evaluator) const {
+        [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
-        if (condition) {
+        if (this->evaluateCondition(evaluator)) {
             return this->getSecondOperand()->evaluate(evaluator);
         } else {
             return this->getThirdOperand()->evaluate(evaluator);
         }
     }
 
+    [[nodiscard]] std::optional<Token::Literal> ASTNodeTernaryExpression::evaluateValue(Evaluator *evaluator) const {
+        [[maybe_unused]] auto context = evaluator->updateRuntime(this);
+
+        if (this->evaluateCondition(evaluator)) {
+            return this->getSecondOperand()->evaluateValue(evaluator);
+        } else {
+            return this->getThirdOperand()->evaluateValue(evaluator);
+        }
+    }
+
 }
\ No newline at end of file
@@ -19,13 +19,9 @@ namespace pl::core::ast {
     void ASTNodeTryCatchStatement::createPatterns(Evaluator *evaluator, std::vector<std::shared_ptr<ptrn::Pattern>> &) const {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
-        auto startOffset = evaluator->getReadOffset();
+        const auto checkpoint = evaluator->createCheckpoint();
         auto &scope = evaluator->getScope(0);
 
-        auto startScopeSize = scope.scope->size();
-        auto startHeapSize = scope.heapStartSize;
-
-
         try {
             for (auto &node : this->m_tryBody) {
                 std::vector<std::shared_ptr<ptrn::Pattern>> newPatterns;
@@ -39,10 +35,7 @@ namespace pl::core::ast {
                     break;
             }
         } catch (err::EvaluatorError::Exception &) {
-            evaluator->setReadOffset(startOffset);
-
-            scope.scope->resize(startScopeSize);
-            scope.heapStartSize = startHeapSize;
+            evaluator->restoreCheckpoint(checkpoint);
 
             for (auto &node : this->m_catchBody) {
                 std::vector<std::shared_ptr<ptrn::Pattern>> newPatterns;
@@ -71,6 +64,8 @@ namespace pl::core::ast {
             evaluator->popScope();
         };
 
+        const auto checkpoint = evaluator->createCheckpoint();
+
         try {
             for (auto &statement : this->m_tryBody) {
                 auto result = statement->execute(evaluator);
@@ -94,8 +89,9 @@ namespace pl::core::ast {
                     }, result.value());
                 }
             }
-        } catch (err::EvaluatorError::Exception &error) {
-            std::ignore = error;
+        } catch (err::EvaluatorError::Exception &) {
+            evaluator->restoreCheckpoint(checkpoint);
+
             for (auto &statement : this->m_catchBody) {
                 auto result = statement->execute(evaluator);
 
@@ -20,6 +20,10 @@ namespace pl::core::ast {
     }
 
     [[nodiscard]] std::unique_ptr<ASTNode> ASTNodeTypeOperator::evaluate(Evaluator *evaluator) const {
+        return std::unique_ptr<ASTNode>(new ASTNodeLiteral(*this->evaluateValue(evaluator)));
+    }
+
+    [[nodiscard]] std::optional<Token::Literal> ASTNodeTypeOperator::evaluateValue(Evaluator *evaluator) const {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
         Token::Literal result;
@@ -46,8 +50,7 @@ namespace pl::core::ast {
             if (this->getOperator() == Token::Operator::TypeNameOf) {
                 if (auto typeApp = dynamic_cast<ASTNodeTypeApplication*>(this->m_expression.get()); typeApp != nullptr) {
                     auto evaluatedType = typeApp->evaluate(evaluator);
-                    result = dynamic_cast<ASTNodeTypeApplication*>(evaluatedType.get())->getTypeName();
-                    return std::unique_ptr<ASTNode>(new ASTNodeLiteral(result));
+                    return dynamic_cast<ASTNodeTypeApplication*>(evaluatedType.get())->getTypeName();
                 }
             }
 
@@ -72,7 +75,7 @@ namespace pl::core::ast {
             }
         }
 
-        return std::unique_ptr<ASTNode>(new ASTNodeLiteral(result));
+        return result;
     }
 
 }
\ No newline at end of file
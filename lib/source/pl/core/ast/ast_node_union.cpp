@@ -16,7 +16,7 @@ namespace pl::core::ast {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
         evaluator->alignToByte();
-        auto pattern = std::make_shared<ptrn::PatternUnion>(evaluator, evaluator->getReadOffset(), 0, getLocation().line);
+        auto pattern = ptrn::Pattern::create<ptrn::PatternUnion>(evaluator, evaluator->getReadOffset(), 0, getLocation().line);
 
         std::vector<std::shared_ptr<ptrn::Pattern>> memberPatterns;
         u64 startOffset = evaluator->getReadOffset();
@@ -55,7 +55,7 @@ namespace pl::core::ast {
                     continue;
 
                 for (auto &existingPattern : memberPatterns) {
-                    if (existingPattern->getVariableName() == varName) {
+                    if (existingPattern->hasSameVariableName(*memberPattern)) {
                         err::E0003.throwError(fmt::format("Redeclaration of identifier '{}'.", existingPattern->getVariableName()), "", member->getLocation());
                     }
                 }
@@ -151,12 +151,10 @@ namespace pl::core::ast {
         if (!initValues.empty()) {
             auto &initValue = initValues.front();
             if (variable->getSection() == ptrn::Pattern::HeapSectionId) {
-                auto &heap = evaluator->getHeap();
-                heap.emplace_back();
-                heap.back().resize(initValue->getSize());
+                auto heapAddress = evaluator->allocateHeapCell(initValue->getSize());
 
                 initValue->setSection(ptrn::Pattern::HeapSectionId);
-                initValue->setOffset(u64(heap.size() - 1) << 32);
+                initValue->setOffset(heapAddress << 32);
             } else if (variable->getSection() == ptrn::Pattern::PatternLocalSectionId) {
                 evaluator->changePatternSection(initValue.get(), ptrn::Pattern::PatternLocalSectionId);
                 initValue->setOffset(0);
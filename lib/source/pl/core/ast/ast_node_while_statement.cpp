@@ -70,16 +70,15 @@ namespace pl::core::ast {
     [[nodiscard]] bool ASTNodeWhileStatement::evaluateCondition(Evaluator *evaluator) const {
         [[maybe_unused]] auto context = evaluator->updateRuntime(this);
 
-        const auto node    = this->getCondition()->evaluate(evaluator);
-        const auto literal = dynamic_cast<ASTNodeLiteral *>(node.get());
-        if (literal == nullptr)
+        const auto value = this->getCondition()->evaluateValue(evaluator);
+        if (!value.has_value())
             err::E0010.throwError("Cannot use void expression as condition.", {}, this->getLocation());
 
         return std::visit(wolv::util::overloaded {
                 [](const std::string &value) -> bool { return !value.empty(); },
                 [this](ptrn::Pattern *const &pattern) -> bool { err::E0002.throwError(fmt::format("Cannot cast {} to bool.", pattern->getTypeName()), {}, this->getLocation()); },
                 [](auto &&value) -> bool { return value != 0; }
-        }, literal->getValue());
+        }, *value);
     }
 
 }
@@ -0,0 +1,85 @@
+#include <pl/core/attributes.hpp>
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace pl::core {
+
+    namespace {
+
+        struct StringHash {
+            using is_transparent = void;
+
+            size_t operator()(std::string_view string) const {
+                return std::hash<std::string_view>{}(string);
+            }
+        };
+
+        class AttributeTable {
+        public:
+            AttributeTable() {
+                // Order has to match the IDs in the attr namespace
+                for (const auto name : { "hidden", "highlight_hidden", "tree_hidden", "sealed", "inline", "export" })
+                    this->insert(name);
+            }
+
+            AttributeId intern(std::string_view name) {
+                if (auto id = this->find(name); id.has_value())
+                    return *id;
+
+                std::unique_lock lock(this->m_mutex);
+                if (auto it = this->m_ids.find(name); it != this->m_ids.end())
+                    return it->second;
+
+                return this->insert(name);
+            }
+
+            std::optional<AttributeId> find(std::string_view name) const {
+                std::shared_lock lock(this->m_mutex);
+                if (auto it = this->m_ids.find(name); it != this->m_ids.end())
+                    return it->second;
+
+                return std::nullopt;
+            }
+
+            const std::string& getName(AttributeId id) const {
+                std::shared_lock lock(this->m_mutex);
+                return this->m_names.at(id);
+            }
+
+        private:
+            AttributeId insert(std::string_view name) {
+                const auto id = AttributeId(this->m_names.size());
+                this->m_ids.emplace(this->m_names.emplace_back(name), id);
+
+                return id;
+            }
+
+            mutable std::shared_mutex m_mutex;
+            std::deque<std::string> m_names;
+            std::unordered_map<std::string, AttributeId, StringHash, std::equal_to<>> m_ids;
+        };
+
+        AttributeTable& getAttributeTable() {
+            static AttributeTable table;
+
+            return table;
+        }
+
+    }
+
+    AttributeId internAttribute(std::string_view name) {
+        return getAttributeTable().intern(name);
+    }
+
+    std::optional<AttributeId> findAttribute(std::string_view name) {
+        return getAttributeTable().find(name);
+    }
+
+    const std::string& getAttributeName(AttributeId id) {
+        return getAttributeTable().getName(id);
+    }
+
+}
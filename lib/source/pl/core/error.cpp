@@ -18,7 +18,7 @@ namespace pl::core::err::impl {
     std::string formatLines(Location location) {
         std::string result;
 
-        const auto lines = wolv::util::splitString(location.source->content, "\n");
+        const auto lines = wolv::util::splitString(std::string(location.source->content), "\n");
 
         if (location.line < lines.size() + 1) {
             const auto lineNumberPrefix = fmt::format("{} | ", location.line);
@@ -12,6 +12,8 @@
 #include <pl/core/ast/ast_node_lvalue_assignment.hpp>
 #include <pl/core/ast/ast_node_literal.hpp>
 #include <pl/core/ast/ast_node_builtin_type.hpp>
+#include <pl/core/ast/ast_node_multi_variable_decl.hpp>
+#include <pl/core/ast/ast_node_struct.hpp>
 
 #include <pl/patterns/pattern_unsigned.hpp>
 #include <pl/patterns/pattern_signed.hpp>
@@ -22,15 +24,78 @@
 #include <pl/patterns/pattern_wide_character.hpp>
 #include <pl/patterns/pattern_string.hpp>
 #include <pl/patterns/pattern_array_dynamic.hpp>
+#include <pl/patterns/pattern_struct.hpp>
 #include <pl/patterns/pattern_padding.hpp>
+#include <pl/patterns/pattern_pointer.hpp>
 #include <pl/patterns/pattern_error.hpp>
 
+#include <algorithm>
 #include <exception>
+#include <ranges>
+#include <thread>
 #include <utility>
 #include "wolv/utils/string.hpp"
 
 namespace pl::core {
 
+    std::shared_ptr<ptrn::Pattern> *Evaluator::Scope::findVariable(const std::string &name) {
+        // Scopes of structs and functions are usually tiny, a linear search is faster there than hashing
+        constexpr static size_t MinIndexedScopeSize = 16;
+
+        if (this->scope == nullptr)
+            return nullptr;
+
+        auto &variables = *this->scope;
+        if (variables.size() < MinIndexedScopeSize) {
+            for (auto &variable : variables | std::views::reverse) {
+                if (variable->hasVariableName(name))
+                    return &variable;
+            }
+
+            return nullptr;
+        }
+
+        const auto indexVariables = [&] {
+            // The scope got truncated since the table was built. It might have grown back to the same size
+            // with different variables, so the last indexed variable has to still be the same one as well
+            if (this->indexedVariableCount > variables.size() ||
+                (this->indexedVariableCount > 0 && variables[this->indexedVariableCount - 1].get() != this->lastIndexedVariable)) {
+                this->variableSlots.clear();
+                this->indexedVariableCount = 0;
+            }
+
+            if (this->indexedVariableCount == 0 && this->renameCount != nullptr)
+                this->indexedRenameCount = *this->renameCount;
+
+            for (; this->indexedVariableCount < variables.size(); this->indexedVariableCount++)
+                this->variableSlots[variables[this->indexedVariableCount]->getVariableName()] = this->indexedVariableCount;
+
+            this->lastIndexedVariable = variables.empty() ? nullptr : variables.back().get();
+        };
+
+        indexVariables();
+
+        auto slot = this->variableSlots.find(name);
+        if (slot == this->variableSlots.end()) {
+            // Another variable might have been renamed to this name after it was indexed
+            if (this->renameCount == nullptr || *this->renameCount == this->indexedRenameCount)
+                return nullptr;
+        } else if (auto &variable = variables[slot->second]; variable->hasVariableName(name)) {
+            return &variable;
+        }
+
+        // A variable got renamed or replaced since the table was built, start over
+        this->variableSlots.clear();
+        this->indexedVariableCount = 0;
+        indexVariables();
+
+        slot = this->variableSlots.find(name);
+        if (slot == this->variableSlots.end())
+            return nullptr;
+        else
+            return &variables[slot->second];
+    }
+
     std::map<std::string, Token::Literal> Evaluator::getOutVariables() const {
         return m_outVariableValues;
     }
@@ -38,6 +103,8 @@ namespace pl::core {
     void Evaluator::setDataSource(u64 baseAddress, size_t dataSize, std::function<void(u64, u8*, size_t)> readerFunction, std::optional<std::function<void(u64, const u8*, size_t)>> writerFunction) {
         this->m_dataBaseAddress = baseAddress;
         this->m_dataSize = dataSize;
+        this->m_dataSourceReader = readerFunction;
+        this->m_dataSourceWriter = writerFunction;
 
         this->m_readerFunction = [this, readerFunction = std::move(readerFunction)](u64 offset, u8* buffer, size_t size) {
             this->m_lastReadAddress = offset;
@@ -147,7 +214,14 @@ namespace pl::core {
 
 
 
-    bool Evaluator::addBuiltinFunction(const std::string &name, api::FunctionParameterCount numParams, std::vector<Token::Literal> defaultParameters, const api::FunctionCallback &function, bool dangerous) {
+    static u64 getNextFunctionRegistryVersion() {
+        // Versions are unique across all evaluators so call sites can't confuse two of them
+        static std::atomic<u64> s_version = 0;
+
+        return ++s_version;
+    }
+
+    bool Evaluator::addBuiltinFunction(const std::string &name, api::FunctionParameterCount numParams, std::vector<Token::Literal> defaultParameters, const api::FunctionSpanCallback &function, bool dangerous) {
         const auto [iter, inserted] = this->m_builtinFunctions.insert({
             name, {
                 numParams,
@@ -156,11 +230,13 @@ namespace pl::core {
             }
         });
 
+        this->m_functionRegistryVersion = getNextFunctionRegistryVersion();
+
         return inserted;
     }
 
-    api::FunctionCallback Evaluator::handleDangerousFunctionCall(const std::string &functionName, const api::FunctionCallback &function) {
-        return [this, function, functionName](core::Evaluator *, const std::vector<core::Token::Literal> &params) -> std::optional<core::Token::Literal> {
+    api::FunctionSpanCallback Evaluator::handleDangerousFunctionCall(const std::string &functionName, const api::FunctionSpanCallback &function) {
+        return [this, function, functionName](core::Evaluator *, std::span<const core::Token::Literal> params) -> std::optional<core::Token::Literal> {
             if (getDangerousFunctionPermission() != DangerousFunctionPermission::Allow) {
                 dangerousFunctionCalled();
 
@@ -173,27 +249,55 @@ namespace pl::core {
         };
     }
 
-    bool Evaluator::addCustomFunction(const std::string &name, api::FunctionParameterCount numParams, std::vector<Token::Literal> defaultParameters, const api::FunctionCallback &function) {
+    bool Evaluator::addCustomFunction(const std::string &name, api::FunctionParameterCount numParams, std::vector<Token::Literal> defaultParameters, const api::FunctionSpanCallback &function) {
         const auto [iter, inserted] = this->m_customFunctions.insert({
             name, {numParams, std::move(defaultParameters), function}
         });
 
+        this->m_functionRegistryVersion = getNextFunctionRegistryVersion();
+
         return inserted;
     }
 
+    std::vector<Token::Literal> &Evaluator::pushArgumentFrame() {
+        // Frames live in a deque so references to outer frames stay valid while nested calls add new ones
+        if (this->m_argumentFrameDepth == this->m_argumentFrames.size())
+            this->m_argumentFrames.emplace_back();
+
+        auto &frame = this->m_argumentFrames[this->m_argumentFrameDepth];
+        this->m_argumentFrameDepth += 1;
+
+        frame.clear();
+        return frame;
+    }
+
+    void Evaluator::popArgumentFrame() {
+        this->m_argumentFrameDepth -= 1;
+
+        // Drop the arguments right away so patterns passed by reference aren't kept alive
+        this->m_argumentFrames[this->m_argumentFrameDepth].clear();
+    }
+
     [[nodiscard]] std::optional<api::Function> Evaluator::findFunction(const std::string &name) const {
-        if (name.empty())
+        if (auto function = this->getFunction(name); function != nullptr)
+            return *function;
+        else
             return std::nullopt;
+    }
+
+    [[nodiscard]] const api::Function *Evaluator::getFunction(const std::string &name) const {
+        if (name.empty())
+            return nullptr;
 
         const auto &customFunctions     = this->getCustomFunctions();
         const auto &builtinFunctions    = this->getBuiltinFunctions();
 
         if (auto customFunction = customFunctions.find(name); customFunction != customFunctions.end())
-            return customFunction->second;
+            return &customFunction->second;
         else if (auto builtinFunction = builtinFunctions.find(name); builtinFunction != builtinFunctions.end())
-            return builtinFunction->second;
+            return &builtinFunction->second;
         else
-            return std::nullopt;
+            return nullptr;
     }
 
     void Evaluator::createParameterPack(const std::string &name, const std::vector<Token::Literal> &values) {
@@ -208,12 +312,10 @@ namespace pl::core {
         if (name == "_")
             return;
 
+        if (this->getScope(0).findVariable(name) != nullptr)
+            err::E0003.throwError(fmt::format("Variable with name '{}' already exists in this scope.", name), {}, type->getLocation());
+
         auto &variables = *this->getScope(0).scope;
-        for (auto &variable : variables) {
-            if (variable->getVariableName() == name) {
-                err::E0003.throwError(fmt::format("Variable with name '{}' already exists in this scope.", name), {}, type->getLocation());
-            }
-        }
 
         auto startOffset = this->getBitwiseReadOffset();
 
@@ -240,10 +342,8 @@ namespace pl::core {
                 auto entryPattern = typePattern->clone();
                 entryPattern->setSection(section);
 
-                auto patternLocalAddress = this->m_patternLocalStorage.empty() ? 0 : this->m_patternLocalStorage.rbegin()->first + 1;
+                auto patternLocalAddress = this->m_patternLocalStorage.allocate(entryPattern->getSize());
                 entryPattern->setOffset(u64(patternLocalAddress) << 32);
-                this->m_patternLocalStorage.insert({ patternLocalAddress, { } });
-                this->m_patternLocalStorage[patternLocalAddress].data.resize(entryPattern->getSize());
 
                 entries.push_back(std::move(entryPattern));
             }
@@ -273,10 +373,8 @@ namespace pl::core {
                     auto entryPattern = typePattern->clone();
                     entryPattern->setLocal(true);
 
-                    auto heapAddress = u64(heap.size());
-                    auto &storage = heap.emplace_back();
+                    auto heapAddress = this->allocateHeapCell(entryPattern->getSize());
                     entryPattern->setOffset(heapAddress << 32);
-                    storage.resize(entryPattern->getSize());
 
                     entries.push_back(std::move(entryPattern));
                 }
@@ -286,8 +384,8 @@ namespace pl::core {
                 pattern->setLocal(true);
                 pattern->setAbsoluteOffset(u64(heap.size() - entryCount) << 32);
             } else {
-                auto heapAddress = u64(heap.size());
-                auto &storage = heap.emplace_back();
+                auto heapAddress = this->allocateHeapCell(0);
+                auto &storage = heap[heapAddress];
 
                 u64 entryOffset = 0;
                 for (size_t i = 0; i < entryCount; i++) {
@@ -337,28 +435,23 @@ namespace pl::core {
 
         if (templateVariable) {
             std::erase_if(this->m_templateParameters.back(), [&](const auto &var) {
-                return var->getVariableName() == name;
+                return var->hasVariableName(name);
             });
         } else {
-            auto &currScope = this->getScope(0);
-            for (auto &variable : *currScope.scope) {
-                if (variable->getVariableName() == name) {
-                    err::E0003.throwError(fmt::format("Variable with name '{}' already exists in this scope.", name), {}, type->getLocation());
-                }
-            }
+            if (this->getScope(0).findVariable(name) != nullptr)
+                err::E0003.throwError(fmt::format("Variable with name '{}' already exists in this scope.", name), {}, type->getLocation());
         }
 
         auto sectionId = this->getSectionId();
         auto startOffset = this->getBitwiseReadOffset();
 
-        auto heapAddress = u64(this->getHeap().size());
+        u64 heapAddress = 0;
         u32 patternLocalAddress = 0;
         if (!reference) {
             if (sectionId == ptrn::Pattern::PatternLocalSectionId) {
-                patternLocalAddress = this->m_patternLocalStorage.empty() ? 0 : this->m_patternLocalStorage.rbegin()->first + 1;
-                this->m_patternLocalStorage.insert({ patternLocalAddress, { } });
+                patternLocalAddress = this->m_patternLocalStorage.allocate(0);
             } else if (sectionId == ptrn::Pattern::HeapSectionId) {
-                this->getHeap().emplace_back();
+                heapAddress = this->allocateHeapCell(0);
             } else {
                 err::E0001.throwError(fmt::format("Attempted to place a variable into section 0x{:X}.", sectionId), {}, type->getLocation());
             }
@@ -372,19 +465,19 @@ namespace pl::core {
         if (auto builtinType = dynamic_cast<const ast::ASTNodeBuiltinType*>(typeDefinition); builtinType != nullptr && builtinType->getType() == Token::ValueType::Auto) {
             // Handle auto variables
             if (!value.has_value())
-                pattern = std::make_shared<ptrn::PatternPadding>(this, 0, 0, 0);
+                pattern = ptrn::Pattern::create<ptrn::PatternPadding>(this, 0, 0, 0);
             else if (std::get_if<u128>(&value.value()) != nullptr)
-                pattern = std::make_shared<ptrn::PatternUnsigned>(this, 0, sizeof(u128), 0);
+                pattern = ptrn::Pattern::create<ptrn::PatternUnsigned>(this, 0, sizeof(u128), 0);
             else if (std::get_if<i128>(&value.value()) != nullptr)
-                pattern = std::make_shared<ptrn::PatternSigned>(this, 0, sizeof(i128), 0);
+                pattern = ptrn::Pattern::create<ptrn::PatternSigned>(this, 0, sizeof(i128), 0);
             else if (std::get_if<double>(&value.value()) != nullptr)
-                pattern = std::make_shared<ptrn::PatternFloat>(this, 0, sizeof(double), 0);
+                pattern = ptrn::Pattern::create<ptrn::PatternFloat>(this, 0, sizeof(double), 0);
             else if (std::get_if<bool>(&value.value()) != nullptr)
-                pattern = std::make_shared<ptrn::PatternBoolean>(this, 0, 0);
+                pattern = ptrn::Pattern::create<ptrn::PatternBoolean>(this, 0, 0);
             else if (std::get_if<char>(&value.value()) != nullptr)
-                pattern = std::make_shared<ptrn::PatternCharacter>(this, 0, 0);
+                pattern = ptrn::Pattern::create<ptrn::PatternCharacter>(this, 0, 0);
             else if (auto string = std::get_if<std::string>(&value.value()); string != nullptr)
-                pattern = std::make_shared<ptrn::PatternString>(this, 0, string->size(), 0);
+                pattern = ptrn::Pattern::create<ptrn::PatternString>(this, 0, string->size(), 0);
             else if (auto patternValue = std::get_if<std::shared_ptr<ptrn::Pattern>>(&value.value()); patternValue != nullptr) {
                 if (reference && !templateVariable)
                     pattern = *patternValue;
@@ -409,7 +502,7 @@ namespace pl::core {
                 pattern = std::move(patterns.front());
             }
             else {
-                pattern = std::make_shared<ptrn::PatternPadding>(this, 0, 0, 0);
+                pattern = ptrn::Pattern::create<ptrn::PatternPadding>(this, 0, 0, 0);
                 pattern->setTypeName(type->getTypeName());
             }
         }
@@ -424,7 +517,7 @@ namespace pl::core {
                 this->getHeap()[heapAddress].resize(pattern->getSize());
             } else if (sectionId == ptrn::Pattern::PatternLocalSectionId) {
                 pattern->setOffset(u64(patternLocalAddress) << 32);
-                this->m_patternLocalStorage[patternLocalAddress].data.resize(pattern->getSize());
+                this->m_patternLocalStorage.getOrCreate(patternLocalAddress).data.resize(pattern->getSize());
             }
         }
 
@@ -513,10 +606,8 @@ namespace pl::core {
         for (auto &[address, child] : pattern->getChildren()) {
             auto childSection = child->getSection();
             if (childSection == 0) {
-                if (!child->isPatternLocal()) {
-                    u32 patternLocalAddress = this->m_patternLocalStorage.empty() ? 0 : this->m_patternLocalStorage.rbegin()->first + 1;
-                    this->m_patternLocalStorage.insert({ patternLocalAddress, { } });
-                }
+                if (!child->isPatternLocal())
+                    (void)this->m_patternLocalStorage.allocate(0);
 
                 child->setSection(section);
             }
@@ -525,32 +616,22 @@ namespace pl::core {
 
     std::shared_ptr<ptrn::Pattern>& Evaluator::getVariableByName(const std::string &name) {
         // Search for variable in current scope
-        {
-            auto &variables = *this->getScope(0).scope;
-            for (auto &variable : variables) {
-                if (variable->getVariableName() == name) {
-                    return variable;
-                }
-            }
-        }
+        if (auto variable = this->getScope(0).findVariable(name); variable != nullptr)
+            return *variable;
 
         // Search for variable in the template parameter list
         {
             auto &variables = this->m_templateParameters.back();
             for (auto &variable : variables) {
-                if (variable->getVariableName() == name) {
+                if (variable->hasVariableName(name)) {
                     return variable;
                 }
             }
         }
 
         // If there's no variable with that name in the current scope, search the global scope
-        auto &variables = *this->getGlobalScope().scope;
-        for (auto &variable : variables) {
-            if (variable->getVariableName() == name) {
-                return variable;
-            }
-        }
+        if (auto variable = this->getGlobalScope().findVariable(name); variable != nullptr)
+            return *variable;
 
         err::E0003.throwError(fmt::format("Cannot find variable '{}' in this scope.", name));
     }
@@ -664,9 +745,9 @@ namespace pl::core {
                  dynamic_cast<ptrn::PatternSigned*>(pattern.get()) != nullptr ||
                  dynamic_cast<ptrn::PatternEnum*>(pattern.get()) != nullptr ||
                  dynamic_cast<ptrn::PatternFloat*>(pattern.get()) != nullptr)) {
-                this->getHeap().emplace_back(inferredSize);
+                auto heapAddress = this->allocateHeapCell(inferredSize);
                 pattern->setSection(ptrn::Pattern::HeapSectionId);
-                pattern->setOffset(u64(this->getHeap().size() - 1) << 32);
+                pattern->setOffset(heapAddress << 32);
                 pattern->setSize(inferredSize);
             }
         }
@@ -699,19 +780,22 @@ namespace pl::core {
             bool mainSection = pattern->getSection() == ptrn::Pattern::MainSectionId;
             bool patternLocalSection = pattern->getSection() == ptrn::Pattern::PatternLocalSectionId;
 
-            auto getStorage = [&, this]() -> auto& {
+            // Heap cells, pattern local cells and sections are stored differently, the callback gets called with whichever one holds the variable
+            auto withStorage = [&, this](const auto &callback) {
                 if (heapSection) {
-                    if (auto &heap = this->getHeap(); heap.size() > pattern->getHeapAddress())
-                        return heap[pattern->getHeapAddress()];
+                    if (auto &heap = this->getHeap(); heap.size() > pattern->getHeapAddress()) {
+                        this->backupHeapCell(pattern->getHeapAddress());
+                        callback(heap[pattern->getHeapAddress()]);
+                    }
                     else
                         err::E0011.throwError(fmt::format("Tried accessing out of bounds heap cell {}. This is a bug.", pattern->getHeapAddress()));
                 } else if (patternLocalSection) {
-                    if (this->m_patternLocalStorage.contains(pattern->getHeapAddress()))
-                        return this->m_patternLocalStorage[pattern->getHeapAddress()].data;
+                    if (auto cell = this->m_patternLocalStorage.find(pattern->getHeapAddress()); cell != nullptr)
+                        callback(cell->data);
                     else
                         err::E0011.throwError(fmt::format("Tried accessing out of bounds pattern local cell {}. This is a bug.", pattern->getHeapAddress()));
                 } else {
-                    return this->getSection(pattern->getSection());
+                    callback(this->getSection(pattern->getSection()));
                 }
             };
 
@@ -724,13 +808,13 @@ namespace pl::core {
 
                     this->accessData(offset, &value, pattern->getSize(), pattern->getSection(), true);
                 } else {
-                    auto &storage = getStorage();
-
-                    if (storage.size() < offset + pattern->getSize())
-                        storage.resize(offset + pattern->getSize());
+                    withStorage([&](auto &storage) {
+                        if (storage.size() < offset + pattern->getSize())
+                            storage.resize(offset + pattern->getSize());
 
-                    if (!storage.empty())
-                        std::memmove(storage.data() + offset, &value, pattern->getSize());
+                        if (!storage.empty())
+                            std::memmove(storage.data() + offset, &value, pattern->getSize());
+                    });
                 }
 
                 if (this->isDebugModeEnabled())
@@ -739,32 +823,32 @@ namespace pl::core {
 
             std::visit(wolv::util::overloaded {
                 [&](const u128 &value) {
-                    changePatternType(pattern, std::make_shared<ptrn::PatternUnsigned>(this, 0, 16, 0));
+                    changePatternType(pattern, ptrn::Pattern::create<ptrn::PatternUnsigned>(this, 0, 16, 0));
 
                     auto adjustedValue = hlp::changeEndianess(value, pattern->getSize(), pattern->getEndian());
                     copyToStorage(adjustedValue);
                 },
                 [&](const i128 &value) {
-                    changePatternType(pattern, std::make_shared<ptrn::PatternSigned>(this, 0, 16, 0));
+                    changePatternType(pattern, ptrn::Pattern::create<ptrn::PatternSigned>(this, 0, 16, 0));
 
                     auto adjustedValue = hlp::changeEndianess(value, pattern->getSize(), pattern->getEndian());
                     adjustedValue = hlp::signExtend(pattern->getSize() * 8, adjustedValue);
                     copyToStorage(adjustedValue);
                 },
                 [&](const bool &value) {
-                    changePatternType(pattern, std::make_shared<ptrn::PatternBoolean>(this, 0, 0));
+                    changePatternType(pattern, ptrn::Pattern::create<ptrn::PatternBoolean>(this, 0, 0));
 
                     auto adjustedValue = hlp::changeEndianess(value, pattern->getSize(), pattern->getEndian());
                     copyToStorage(adjustedValue);
                 },
                 [&](const char &value) {
-                    changePatternType(pattern, std::make_shared<ptrn::PatternCharacter>(this, 0, 0));
+                    changePatternType(pattern, ptrn::Pattern::create<ptrn::PatternCharacter>(this, 0, 0));
 
                     auto adjustedValue = hlp::changeEndianess(value, pattern->getSize(), pattern->getEndian());
                     copyToStorage(adjustedValue);
                 },
                 [&](const double &value) {
-                    changePatternType(pattern, std::make_shared<ptrn::PatternFloat>(this, 0, 8, 0));
+                    changePatternType(pattern, ptrn::Pattern::create<ptrn::PatternFloat>(this, 0, 8, 0));
 
                     if (pattern->getSize() == sizeof(float)) {
                         auto floatValue = float(value);
@@ -782,7 +866,7 @@ namespace pl::core {
                     }
                 },
                 [&](const std::string &value) {
-                    changePatternType(pattern, std::make_shared<ptrn::PatternString>(this, 0, value.length(), 0));
+                    changePatternType(pattern, ptrn::Pattern::create<ptrn::PatternString>(this, 0, value.length(), 0));
 
                     pattern->setSize(value.size());
 
@@ -796,28 +880,29 @@ namespace pl::core {
                         pattern = value;
                     }
 
-                    auto &storage = getStorage();
-                    auto localOffset = pattern->getOffset() & 0xFFFF'FFFF;
-                    if (value->getSection() != ptrn::Pattern::InstantiationSectionId) {
-                        if (heapSection || patternLocalSection) {
-                            storage.resize(localOffset + value->getSize());
-                            this->readData(value->getOffset(), storage.data() + localOffset, value->getSize(), value->getSection());
-                        } else if (storage.size() < pattern->getOffset() + pattern->getSize()) {
-                            storage.resize(pattern->getOffset() + pattern->getSize());
-                            this->readData(value->getOffset(), storage.data() + pattern->getOffset(), value->getSize(), value->getSection());
-                        }
-                    } else {
-                        if (heapSection || patternLocalSection) {
-                            storage.resize(localOffset + value->getSize());
-                            std::fill(storage.begin() + localOffset, storage.begin() + localOffset + value->getSize(), 0x00);
+                    withStorage([&, this](auto &storage) {
+                        auto localOffset = pattern->getOffset() & 0xFFFF'FFFF;
+                        if (value->getSection() != ptrn::Pattern::InstantiationSectionId) {
+                            if (heapSection || patternLocalSection) {
+                                storage.resize(localOffset + value->getSize());
+                                this->readData(value->getOffset(), storage.data() + localOffset, value->getSize(), value->getSection());
+                            } else if (storage.size() < pattern->getOffset() + pattern->getSize()) {
+                                storage.resize(pattern->getOffset() + pattern->getSize());
+                                this->readData(value->getOffset(), storage.data() + pattern->getOffset(), value->getSize(), value->getSection());
+                            }
                         } else {
-                            storage.resize(value->getSize());
-                            std::fill(storage.begin(), storage.end(), 0x00);
+                            if (heapSection || patternLocalSection) {
+                                storage.resize(localOffset + value->getSize());
+                                std::fill(storage.begin() + localOffset, storage.begin() + localOffset + value->getSize(), 0x00);
+                            } else {
+                                storage.resize(value->getSize());
+                                std::fill(storage.begin(), storage.end(), 0x00);
+                            }
                         }
-                    }
 
-                    if (this->isDebugModeEnabled())
-                        this->getConsole().log(LogConsole::Level::Debug, fmt::format("Setting local variable '{}' to {:02X}.", pattern->getVariableName(), fmt::join(storage, " ")));
+                        if (this->isDebugModeEnabled())
+                            this->getConsole().log(LogConsole::Level::Debug, fmt::format("Setting local variable '{}' to {:02X}.", pattern->getVariableName(), fmt::join(storage, " ")));
+                    });
                 }
             }, castedValue);
         }
@@ -842,12 +927,296 @@ namespace pl::core {
 
         const auto &heap = this->getHeap();
 
-        this->m_scopes.emplace_back(std::make_unique<Scope>(parent, &scope, heap.size(), clearScopeOnPop));
+        this->m_scopes.emplace_back(std::make_unique<Scope>(parent, &scope, heap.size(), clearScopeOnPop, &this->m_variableRenameCount));
 
         if (this->isDebugModeEnabled())
             this->getConsole().log(LogConsole::Level::Debug, fmt::format("Entering new scope #{}. Parent: '{}', Heap Size: {}.", this->m_scopes.size(), parent == nullptr ? "None" : parent->getVariableName(), heap.size()));
     }
 
+    u32 Evaluator::PatternLocalStorage::allocate(size_t size) {
+        while (!this->m_freeCells.empty()) {
+            const auto address = this->m_freeCells.back();
+            this->m_freeCells.pop_back();
+
+            // Free cells may have been recreated through getOrCreate() in the meantime
+            auto &cell = this->m_cells[address];
+            if (cell.used)
+                continue;
+
+            cell.used = true;
+            cell.data.referenceCount = 0;
+            cell.data.data.resize(size);
+
+            return address;
+        }
+
+        const auto address = u32(this->m_cells.size());
+        this->m_cells.push_back({ { 0, PatternLocalData::Buffer(size) }, true });
+
+        return address;
+    }
+
+    Evaluator::PatternLocalData &Evaluator::PatternLocalStorage::getOrCreate(u32 address) {
+        if (address >= this->m_cells.size()) {
+            for (auto i = u32(this->m_cells.size()); i < address; i++)
+                this->m_freeCells.push_back(i);
+
+            this->m_cells.resize(u64(address) + 1, { { 0, { } }, false });
+        }
+
+        auto &cell = this->m_cells[address];
+        if (!cell.used) {
+            cell.used = true;
+            cell.data.referenceCount = 0;
+        }
+
+        return cell.data;
+    }
+
+    void Evaluator::PatternLocalStorage::release(u32 address) {
+        auto &cell = this->m_cells[address];
+
+        cell.used = false;
+        cell.data.data.clear();
+        this->m_freeCells.push_back(address);
+    }
+
+    Evaluator::HeapCell::HeapCell(hlp::BumpArena &arena, size_t size)
+        : m_arena(&arena), m_arenaMarker(arena.getMarker()), m_data(arena.allocate(size)), m_size(size), m_capacity(size) {
+        std::fill_n(this->m_data, size, 0x00);
+    }
+
+    void Evaluator::HeapCell::resize(size_t size) {
+        if (size > this->m_capacity) {
+            if (this->m_ownedData != nullptr || !this->m_arena->extend(this->m_data, this->m_capacity, size)) {
+                // Other cells were allocated after this one, its memory can't grow inside the arena anymore
+                const auto capacity = std::max(size, this->m_capacity * 2);
+                auto data = std::make_unique_for_overwrite<u8[]>(capacity);
+                std::copy_n(this->m_data, this->m_size, data.get());
+
+                this->m_ownedData = std::move(data);
+                this->m_data = this->m_ownedData.get();
+                this->m_capacity = capacity;
+            } else {
+                this->m_capacity = size;
+            }
+        }
+
+        if (size > this->m_size)
+            std::fill(this->m_data + this->m_size, this->m_data + size, 0x00);
+
+        this->m_size = size;
+    }
+
+    void Evaluator::HeapCell::assign(std::span<const u8> data) {
+        this->resize(data.size());
+        std::copy(data.begin(), data.end(), this->m_data);
+    }
+
+    u64 Evaluator::allocateHeapCell(size_t size) {
+        const auto address = u64(this->m_heap.size());
+
+        this->m_heap.emplace_back(this->m_heapArena, size);
+
+        return address;
+    }
+
+    void Evaluator::truncateHeap(size_t size) {
+        if (this->m_heap.size() <= size)
+            return;
+
+        // Cells are allocated in order, everything from the first removed cell onwards can be handed back to the arena
+        const auto marker = this->m_heap[size].getArenaMarker();
+        this->m_heap.erase(this->m_heap.begin() + i64(size), this->m_heap.end());
+        this->m_heapArena.rewind(marker);
+    }
+
+    Evaluator::HeapCheckpoint Evaluator::createHeapCheckpoint() {
+        HeapCheckpoint checkpoint = { this->m_heap.size(), this->m_heapWatermark, this->m_heapUndoLogStart, this->m_heapEpoch };
+
+        this->m_heapWatermark = this->m_heap.size();
+        this->m_heapUndoLogStart = this->m_heapUndoLog.size();
+        this->m_heapEpochCount += 1;
+        this->m_heapEpoch = this->m_heapEpochCount;
+
+        return checkpoint;
+    }
+
+    void Evaluator::restoreHeapCheckpoint(const HeapCheckpoint &checkpoint) {
+        this->truncateHeap(checkpoint.heapSize);
+        while (this->m_heap.size() < checkpoint.heapSize)
+            (void)this->allocateHeapCell(0);
+
+        // Put back the original contents of all cells that were modified, newest first
+        while (this->m_heapUndoLog.size() > this->m_heapUndoLogStart) {
+            const auto &entry = this->m_heapUndoLog.back();
+            auto &cell = this->m_heap[entry.index];
+            cell.assign(entry.data);
+            cell.setBackupEpoch(entry.previousEpoch);
+            this->m_heapUndoLog.pop_back();
+        }
+
+        this->m_heapWatermark = checkpoint.previousWatermark;
+        this->m_heapUndoLogStart = checkpoint.previousUndoLogStart;
+        this->m_heapEpoch = checkpoint.previousEpoch;
+    }
+
+    void Evaluator::backupHeapCell(size_t index) {
+        // Cells above the watermark were created after the checkpoint and simply get discarded on restore
+        if (index >= this->m_heapWatermark)
+            return;
+
+        // Only the first modification needs to be recorded
+        auto &cell = this->m_heap[index];
+        if (cell.getBackupEpoch() == this->m_heapEpoch)
+            return;
+
+        this->m_heapUndoLog.push_back({ index, cell.getBackupEpoch(), std::vector<u8>(cell.begin(), cell.end()) });
+        cell.setBackupEpoch(this->m_heapEpoch);
+    }
+
+    bool Evaluator::canUseTypeLayoutCache() const {
+        if (this->m_readOrderReversed)
+            return false;
+
+        // Instantiating a cached layout doesn't visit the type's members, so it would skip over breakpoints
+        if (this->m_evaluationMode != EvaluationMode::Release && (!this->m_breakpoints.empty() || this->m_shouldPauseNextLine))
+            return false;
+
+        const auto section = this->getSectionId();
+        return section != ptrn::Pattern::HeapSectionId && section != ptrn::Pattern::PatternLocalSectionId && section != ptrn::Pattern::InstantiationSectionId;
+    }
+
+    std::shared_ptr<ptrn::Pattern> Evaluator::instantiateCachedTypeLayout(const ast::ASTNode *type) {
+        if (!this->canUseTypeLayoutCache())
+            return nullptr;
+
+        const auto it = this->m_typeLayoutCache.find({ type, this->m_defaultEndian, this->getSectionId() });
+        if (it == this->m_typeLayoutCache.end())
+            return nullptr;
+
+        auto pattern = it->second->clone();
+        pattern->setOffset(this->m_currOffset);
+        this->registerTypeLayoutInstance(pattern.get());
+
+        this->m_currOffset += pattern->getSize();
+
+        return pattern;
+    }
+
+    void Evaluator::cacheTypeLayout(const ast::ASTNode *type, const std::shared_ptr<ptrn::Pattern> &pattern) {
+        if (pattern == nullptr || !this->canUseTypeLayoutCache())
+            return;
+
+        this->m_typeLayoutCache.try_emplace({ type, this->m_defaultEndian, this->getSectionId() }, pattern->clone());
+    }
+
+    std::shared_ptr<ptrn::PointeeTable> Evaluator::getPointeeTable(const ast::ASTNode *type) {
+        // Pointees taken from a table don't get evaluated again, the same restrictions as for cached layouts apply
+        if (!this->canUseTypeLayoutCache())
+            return nullptr;
+
+        auto &table = this->m_pointeeTables[{ type, this->m_defaultEndian, this->getSectionId() }];
+        if (table == nullptr)
+            table = std::make_shared<ptrn::PointeeTable>();
+
+        return table;
+    }
+
+    void Evaluator::registerTypeLayoutInstance(ptrn::Pattern *pattern) {
+        // Copies don't get registered on creation, do what a freshly created pattern would have gotten
+        auto structPattern = dynamic_cast<ptrn::PatternStruct *>(pattern);
+        if (structPattern != nullptr) {
+            for (const auto &member : structPattern->getEntries())
+                this->registerTypeLayoutInstance(member.get());
+        }
+
+        if (!pattern->hasOverriddenColor()) {
+            if (structPattern != nullptr && structPattern->getEntryCount() > 0)
+                pattern->setBaseColor(structPattern->getEntry(0)->getColor());
+            else
+                pattern->setBaseColor(this->getNextPatternColor());
+        }
+
+        for (AttributeId attribute = 0; pattern->m_attributeFlags != 0 && attribute < attr::FlagCount; attribute++) {
+            if (pattern->m_attributeFlags & (1U << attribute))
+                this->addAttributedPattern(attribute, pattern);
+        }
+
+        if (pattern->m_coldData != nullptr) {
+            for (const auto attribute : pattern->m_coldData->attributeIds)
+                this->addAttributedPattern(attribute, pattern);
+        }
+    }
+
+    void Evaluator::releaseHeapCells(size_t minSize) {
+        const auto currHeapSize = this->m_heap.size();
+
+        // Cells that are still referenced by a pattern need to stay alive, together with everything below them
+        auto heapSize = std::min(currHeapSize, this->m_heapReferenceCounts.size());
+        while (heapSize > minSize && this->m_heapReferenceCounts[heapSize - 1] == 0)
+            heapSize -= 1;
+        heapSize = std::max(heapSize, minSize);
+
+        for (auto index = heapSize; index < std::min(currHeapSize, this->m_heapWatermark); index++)
+            this->backupHeapCell(index);
+
+        this->truncateHeap(heapSize);
+    }
+
+    Evaluator::Checkpoint Evaluator::createCheckpoint() const {
+        const auto &scope = this->getScope(0);
+
+        return {
+            this->getBitwiseReadOffset(),
+            this->m_scopes.size(),
+            scope.scope == nullptr ? 0 : scope.scope->size(),
+            scope.heapStartSize,
+            this->m_heap.size(),
+            this->m_sectionIdStack.size(),
+            this->m_callStack.size()
+        };
+    }
+
+    void Evaluator::restoreCheckpoint(const Checkpoint &checkpoint) {
+        while (this->m_scopes.size() > checkpoint.scopeCount)
+            this->popScope();
+
+        auto &scope = this->getScope(0);
+        if (scope.scope != nullptr && scope.scope->size() > checkpoint.scopePatternCount) {
+            scope.scope->resize(checkpoint.scopePatternCount);
+
+            // Variables that were rolled back can't be looked up through the slot table anymore
+            scope.variableSlots.clear();
+            scope.indexedVariableCount = 0;
+            scope.lastIndexedVariable = nullptr;
+        }
+        scope.heapStartSize = checkpoint.scopeHeapStartSize;
+
+        this->releaseHeapCells(checkpoint.heapSize);
+
+        if (this->m_sectionIdStack.size() > checkpoint.sectionIdStackSize)
+            this->m_sectionIdStack.resize(checkpoint.sectionIdStackSize);
+
+        // Frames of an error that got handled don't belong to any later stack trace
+        if (this->m_callStack.size() > checkpoint.callStackSize)
+            this->m_callStack.resize(checkpoint.callStackSize);
+
+        this->setBitwiseReadOffset(checkpoint.readOffset);
+    }
+
+    bool Evaluator::speculate(const std::function<void()> &callback) {
+        const auto checkpoint = this->createCheckpoint();
+
+        try {
+            callback();
+            return true;
+        } catch (err::EvaluatorError::Exception &) {
+            this->restoreCheckpoint(checkpoint);
+            return false;
+        }
+    }
+
     void Evaluator::popScope() {
         if (this->m_scopes.empty())
             return;
@@ -859,13 +1228,7 @@ namespace pl::core {
         if (currScope.clearOnPop && currScope.scope != nullptr)
             currScope.scope->clear();
 
-        auto heapSize = currScope.heapStartSize;
-        for (const auto &[address, referenceCount] : this->m_heapReferenceCounts) {
-            if (referenceCount > 0 && address >= heapSize)
-                heapSize = u64(address) + 1;
-        }
-
-        heap.resize(heapSize);
+        this->releaseHeapCells(currScope.heapStartSize);
 
         if (this->isDebugModeEnabled())
             this->getConsole().log(LogConsole::Level::Debug, fmt::format("Exiting scope #{}. Parent: '{}', Heap Size: {}.", this->m_scopes.size(), currScope.parent == nullptr ? "None" : currScope.parent->getVariableName(), heap.size()));
@@ -889,6 +1252,156 @@ namespace pl::core {
         return result;
     }
 
+    namespace {
+
+        // Types whose patterns can be created without running any code or looking anything up but the type itself
+        bool isPlainDataType(const ast::ASTNode *node) {
+            if (auto attributable = dynamic_cast<const ast::Attributable *>(node); attributable != nullptr && !attributable->getAttributes().empty())
+                return false;
+
+            if (auto typeApplication = dynamic_cast<const ast::ASTNodeTypeApplication *>(node); typeApplication != nullptr) {
+                return typeApplication->getType() != nullptr && !typeApplication->isReference() && typeApplication->getTemplateArguments().empty() &&
+                       isPlainDataType(typeApplication->getType().get());
+            } else if (auto typeDecl = dynamic_cast<const ast::ASTNodeTypeDecl *>(node); typeDecl != nullptr) {
+                return typeDecl->isValid() && !typeDecl->isTemplateType() && isPlainDataType(typeDecl->getType().get());
+            } else if (dynamic_cast<const ast::ASTNodeBuiltinType *>(node) != nullptr) {
+                return ast::ASTNodeStruct::isStaticType(node);
+            } else if (auto structType = dynamic_cast<const ast::ASTNodeStruct *>(node); structType != nullptr) {
+                return structType->hasStaticLayout() &&
+                       std::ranges::all_of(structType->getInheritance(), [](const auto &type) { return isPlainDataType(type.get()); }) &&
+                       std::ranges::all_of(structType->getMembers(), [](const auto &member) { return isPlainDataType(member.get()); });
+            } else if (auto variableDecl = dynamic_cast<const ast::ASTNodeVariableDecl *>(node); variableDecl != nullptr) {
+                return isPlainDataType(variableDecl->getType().get());
+            } else if (auto arrayDecl = dynamic_cast<const ast::ASTNodeArrayVariableDecl *>(node); arrayDecl != nullptr) {
+                return isPlainDataType(arrayDecl->getType().get());
+            } else if (auto multiVariableDecl = dynamic_cast<const ast::ASTNodeMultiVariableDecl *>(node); multiVariableDecl != nullptr) {
+                return std::ranges::all_of(multiVariableDecl->getVariables(), [](const auto &variable) { return isPlainDataType(variable.get()); });
+            }
+
+            return false;
+        }
+
+        bool isConstantOffset(const std::unique_ptr<ast::ASTNode> &node) {
+            const auto literal = dynamic_cast<const ast::ASTNodeLiteral *>(node.get());
+
+            return literal != nullptr && !literal->getValue().isString() && !literal->getValue().isPattern();
+        }
+
+        // Placements that neither depend on the cursor nor on anything that got evaluated before them
+        bool isIndependentPlacement(const ast::ASTNode *node) {
+            if (auto variableDecl = dynamic_cast<const ast::ASTNodeVariableDecl *>(node); variableDecl != nullptr) {
+                return isConstantOffset(variableDecl->getPlacementOffset()) &&
+                       variableDecl->getPlacementSection() == nullptr &&
+                       !variableDecl->isInVariable() && !variableDecl->isOutVariable() &&
+                       isPlainDataType(variableDecl);
+            } else if (auto arrayDecl = dynamic_cast<const ast::ASTNodeArrayVariableDecl *>(node); arrayDecl != nullptr) {
+                return isConstantOffset(arrayDecl->getPlacementOffset()) &&
+                       isConstantOffset(arrayDecl->getSize()) &&
+                       arrayDecl->getPlacementSection() == nullptr &&
+                       isPlainDataType(arrayDecl);
+            }
+
+            return false;
+        }
+
+    }
+
+    bool Evaluator::canEvaluatePlacementsConcurrently() const {
+        // Debuggable runs need to stop at breakpoints in source order
+        if (this->m_workerCount <= 1 || this->m_evaluationMode != EvaluationMode::Release)
+            return false;
+
+        return !this->m_readOrderReversed && this->getSectionId() == ptrn::Pattern::MainSectionId && this->m_dataSourceReader != nullptr;
+    }
+
+    void Evaluator::evaluatePlacementsConcurrently(std::span<ast::ASTNode* const> nodes) {
+        const auto workerCount = std::min<size_t>(this->m_workerCount, nodes.size());
+        while (this->m_workers.size() < workerCount)
+            this->m_workers.push_back(std::make_unique<Evaluator>());
+
+        std::vector<std::vector<std::shared_ptr<ptrn::Pattern>>> results(workerCount);
+        std::vector<std::exception_ptr> errors(workerCount);
+
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(workerCount);
+
+            for (size_t i = 0; i < workerCount; i++) {
+                auto &worker = *this->m_workers[i];
+                worker.m_patternLanguage = this->m_patternLanguage;
+                worker.setDataSource(this->m_dataBaseAddress, this->m_dataSize, this->m_dataSourceReader, this->m_dataSourceWriter);
+                worker.setDefaultEndian(this->m_defaultEndian);
+                worker.setEvaluationMode(EvaluationMode::Release);
+                worker.setEvaluationDepth(this->m_evalDepth);
+                worker.setArrayLimit(this->m_arrayLimit);
+                worker.setPatternLimit(this->m_patternLimit);
+                // All workers share one pattern count so the limit applies to the whole run instead of every worker
+                worker.m_patternCounter = this->m_patternCounter;
+                worker.setLoopLimit(this->m_loopLimit);
+                worker.setPatternColorPalette(this->m_patternColorPalette);
+
+                // Every worker gets a consecutive chunk so merging their results keeps the source order
+                const auto chunkStart = i * nodes.size() / workerCount;
+                const auto chunkEnd   = (i + 1) * nodes.size() / workerCount;
+                threads.emplace_back([this, &worker, chunk = nodes.subspan(chunkStart, chunkEnd - chunkStart), &result = results[i], &error = errors[i]] {
+                    try {
+                        worker.evaluatePlacements(*this, chunk, result);
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                });
+            }
+        }
+
+        for (size_t i = 0; i < workerCount; i++) {
+            if (errors[i] != nullptr) {
+                this->m_callStack = this->m_workers[i]->m_callStack;
+                std::rethrow_exception(errors[i]);
+            }
+
+            for (auto &pattern : results[i]) {
+                // Colors are handed out by this evaluator so they don't depend on how the placements were split up
+                this->registerTypeLayoutInstance(pattern.get());
+                this->m_patterns.push_back(std::move(pattern));
+            }
+        }
+
+        // Top-level placements leave the cursor behind them, continue after the last one like a sequential evaluation would
+        this->setBitwiseReadOffset(this->m_workers[workerCount - 1]->getBitwiseReadOffset());
+    }
+
+    void Evaluator::evaluatePlacements(const Evaluator &parent, std::span<ast::ASTNode* const> nodes, std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) {
+        this->m_evaluated = false;
+        this->m_aborted = false;
+        this->m_readOrderReversed = false;
+        this->m_currBitOffset = 0;
+        this->m_sectionIdStack.clear();
+        this->m_scopes.clear();
+        this->m_callStack.clear();
+        this->m_typeLayoutCache.clear();
+        this->m_pointeeTables.clear();
+        this->m_templateParameters.clear();
+        this->m_typeTemplateParameters.clear();
+        this->m_currentTemplateArguments.clear();
+        this->setCurrentControlFlowStatement(ControlFlowStatement::None);
+
+        ON_SCOPE_EXIT {
+            this->m_scopes.clear();
+            this->m_evaluated = true;
+        };
+
+        this->pushScope(nullptr, patterns);
+        this->pushTemplateParameters();
+
+        for (auto node : nodes) {
+            parent.handleAbort();
+
+            std::vector<std::shared_ptr<ptrn::Pattern>> nodePatterns;
+            node->createPatterns(this, nodePatterns);
+            std::ranges::move(nodePatterns, std::back_inserter(patterns));
+        }
+    }
+
     void Evaluator::accessData(u64 address, void *buffer, size_t size, u64 sectionId, bool write) {
         if (size == 0 || buffer == nullptr)
             return;
@@ -906,6 +1419,9 @@ namespace pl::core {
             auto heapAddress = (address >> 32);
             auto storageAddress = address & 0xFFFF'FFFF;
             if (heapAddress < heap.size()) {
+                if (write || storageAddress + size > heap[heapAddress].size())
+                    this->backupHeapCell(heapAddress);
+
                 auto &storage = heap[heapAddress];
 
                 if (storageAddress + size > storage.size()) {
@@ -920,12 +1436,10 @@ namespace pl::core {
             else
                 err::E0011.throwError(fmt::format("Tried accessing out of bounds heap cell {}. This is a bug.", heapAddress));
         } else if (sectionId == ptrn::Pattern::PatternLocalSectionId) {
-            auto &patternLocal = this->m_patternLocalStorage;
-
             auto heapAddress = (address >> 32);
             auto storageAddress = address & 0xFFFF'FFFF;
-            if (patternLocal.contains(heapAddress)) {
-                auto &storage = patternLocal[heapAddress].data;
+            if (auto cell = this->m_patternLocalStorage.find(heapAddress); cell != nullptr) {
+                auto &storage = cell->data;
 
                 if (storageAddress + size > storage.size()) {
                     storage.resize(storageAddress + size);
@@ -1008,7 +1522,7 @@ namespace pl::core {
         if (id == ptrn::Pattern::MainSectionId)
             err::E0011.throwError("Cannot access main section.");
         else if (id == ptrn::Pattern::HeapSectionId)
-            return this->m_heap.back();
+            err::E0011.throwError("Cannot access heap as a section.");
         else if (this->m_sections.contains(id))
             return this->m_sections[id].data;
         else if (id == ptrn::Pattern::InstantiationSectionId)
@@ -1020,6 +1534,8 @@ namespace pl::core {
     u64 Evaluator::getSectionSize(u64 id) {
         if (id == ptrn::Pattern::MainSectionId)
             return this->getDataSize();
+        else if (id == ptrn::Pattern::HeapSectionId)
+            return this->m_heap.empty() ? 0 : this->m_heap.back().size();
         else
             return this->getSection(id).size();
     }
@@ -1043,12 +1559,23 @@ namespace pl::core {
         this->m_outVariableValues.clear();
 
         this->m_customFunctions.clear();
-        this->m_patterns.clear();
+        this->m_functionRegistryVersion = getNextFunctionRegistryVersion();
+        this->releasePatterns();
+
+        if (this->m_patternArenaEnabled)
+            this->m_patternArena = std::make_shared<std::pmr::synchronized_pool_resource>();
 
         this->m_scopes.clear();
         this->m_callStack.clear();
+        this->m_typeLayoutCache.clear();
+        this->m_pointeeTables.clear();
         this->m_heap.clear();
+        this->m_heapArena.rewind({ });
         this->m_heapReferenceCounts.clear();
+        this->m_heapUndoLog.clear();
+        this->m_heapUndoLogStart = 0;
+        this->m_heapWatermark = 0;
+        this->m_heapEpoch = 0;
 
         this->m_templateParameters.clear();
         this->m_currentTemplateArguments.clear();
@@ -1089,10 +1616,8 @@ namespace pl::core {
         this->m_sourceLineLength.clear();
         for (auto &topLevelNode : ast) {
             if (topLevelNode->getLocation().source->mainSource) {
-                std::vector<std::string> sourceLines = wolv::util::splitString(topLevelNode->getLocation().source->content, "\n");
-                for (const auto &sourceLine : sourceLines) {
-                    this->m_sourceLineLength.push_back(sourceLine.size());
-                }
+                for (const auto sourceLine : std::views::split(topLevelNode->getLocation().source->content, '\n'))
+                    this->m_sourceLineLength.push_back(std::ranges::distance(sourceLine));
                 break;
             }
         }
@@ -1103,117 +1628,134 @@ namespace pl::core {
             this->pushScope(nullptr, this->m_patterns);
             this->pushTemplateParameters();
 
+            std::vector<ast::ASTNode*> nodes;
             for (auto &topLevelNode : ast) {
-                std::vector<ast::ASTNode*> nodes;
                 if (auto compoundNode = dynamic_cast<ast::ASTNodeCompoundStatement*>(topLevelNode.get()))
-                    nodes = unpackCompoundStatements(compoundNode->getStatements());
+                    std::ranges::copy(unpackCompoundStatements(compoundNode->getStatements()), std::back_inserter(nodes));
                 else
                     nodes.push_back(topLevelNode.get());
+            }
+
+            size_t sequentialEnd = 0;
+            for (size_t nodeIndex = 0; nodeIndex < nodes.size(); nodeIndex++) {
+                auto node = nodes[nodeIndex];
+                if (node == nullptr)
+                    continue;
+
+                if (nodeIndex >= sequentialEnd && this->canEvaluatePlacementsConcurrently()) {
+                    auto placementsEnd = nodeIndex;
+                    while (placementsEnd < nodes.size() && isIndependentPlacement(nodes[placementsEnd]))
+                        placementsEnd += 1;
 
-                for (auto node : nodes) {
-                    if (node == nullptr)
+                    if (placementsEnd - nodeIndex >= this->m_workerCount) {
+                        this->evaluatePlacementsConcurrently(std::span(nodes).subspan(nodeIndex, placementsEnd - nodeIndex));
+                        nodeIndex = placementsEnd - 1;
                         continue;
+                    }
 
-                    auto startOffset = this->getBitwiseReadOffset();
+                    // Too few placements to be worth splitting up, don't look at them again
+                    sequentialEnd = placementsEnd;
+                }
 
-                    if (dynamic_cast<ast::ASTNodeTypeDecl *>(node) != nullptr) {
-                        // Don't create patterns from type declarations
-                    } else if (dynamic_cast<ast::ASTNodeFunctionDefinition *>(node) != nullptr) {
-                        this->m_customFunctionDefinitions.push_back(node->evaluate(this));
-                    } else if (auto varDeclNode = dynamic_cast<ast::ASTNodeVariableDecl *>(node); varDeclNode != nullptr) {
-                        bool localVariable = varDeclNode->getPlacementOffset() == nullptr;
+                auto startOffset = this->getBitwiseReadOffset();
 
-                        if (localVariable)
-                            this->pushSectionId(ptrn::Pattern::HeapSectionId);
+                if (dynamic_cast<ast::ASTNodeTypeDecl *>(node) != nullptr) {
+                    // Don't create patterns from type declarations
+                } else if (dynamic_cast<ast::ASTNodeFunctionDefinition *>(node) != nullptr) {
+                    this->m_customFunctionDefinitions.push_back(node->evaluate(this));
+                } else if (auto varDeclNode = dynamic_cast<ast::ASTNodeVariableDecl *>(node); varDeclNode != nullptr) {
+                    bool localVariable = varDeclNode->getPlacementOffset() == nullptr;
 
-                        std::vector<std::shared_ptr<ptrn::Pattern>> patterns;
+                    if (localVariable)
+                        this->pushSectionId(ptrn::Pattern::HeapSectionId);
 
-                        ON_SCOPE_EXIT {
-                            for (auto &pattern : patterns) {
-                                if (localVariable) {
-                                    auto name = pattern->getVariableName();
-                                    wolv::util::unused(varDeclNode->execute(this));
+                    std::vector<std::shared_ptr<ptrn::Pattern>> patterns;
 
-                                    this->setBitwiseReadOffset(startOffset);
-                                } else {
-                                    this->m_patterns.push_back(std::move(pattern));
-                                }
+                    ON_SCOPE_EXIT {
+                        for (auto &pattern : patterns) {
+                            if (localVariable) {
+                                auto name = pattern->getVariableName();
+                                wolv::util::unused(varDeclNode->execute(this));
 
-                                if (this->getCurrentControlFlowStatement() == ControlFlowStatement::Return)
-                                    break;
+                                this->setBitwiseReadOffset(startOffset);
+                            } else {
+                                this->m_patterns.push_back(std::move(pattern));
                             }
 
-                            {
-                                auto name = varDeclNode->getName();
-                                if (varDeclNode->isInVariable() && this->m_inVariables.contains(name))
-                                    this->setVariable(name, this->m_inVariables[name]);
-                            }
+                            if (this->getCurrentControlFlowStatement() == ControlFlowStatement::Return)
+                                break;
+                        }
 
-                            if (localVariable)
-                                this->popSectionId();
-                        };
+                        {
+                            auto name = varDeclNode->getName();
+                            if (varDeclNode->isInVariable() && this->m_inVariables.contains(name))
+                                this->setVariable(name, this->m_inVariables[name]);
+                        }
 
-                        varDeclNode->createPatterns(this, patterns);
+                        if (localVariable)
+                            this->popSectionId();
+                    };
 
-                    } else if (auto arrayVarDeclNode = dynamic_cast<ast::ASTNodeArrayVariableDecl *>(node); arrayVarDeclNode != nullptr) {
-                        bool localVariable = arrayVarDeclNode->getPlacementOffset() == nullptr;
+                    varDeclNode->createPatterns(this, patterns);
 
-                        if (localVariable)
-                            this->pushSectionId(ptrn::Pattern::HeapSectionId);
+                } else if (auto arrayVarDeclNode = dynamic_cast<ast::ASTNodeArrayVariableDecl *>(node); arrayVarDeclNode != nullptr) {
+                    bool localVariable = arrayVarDeclNode->getPlacementOffset() == nullptr;
 
-                        std::vector<std::shared_ptr<ptrn::Pattern>> patterns;
+                    if (localVariable)
+                        this->pushSectionId(ptrn::Pattern::HeapSectionId);
 
-                        ON_SCOPE_EXIT {
-                            for (auto &pattern : patterns) {
-                                if (localVariable) {
-                                    wolv::util::unused(arrayVarDeclNode->execute(this));
+                    std::vector<std::shared_ptr<ptrn::Pattern>> patterns;
 
-                                    this->setBitwiseReadOffset(startOffset);
-                                } else {
-                                    this->m_patterns.push_back(std::move(pattern));
-                                }
-                            }
+                    ON_SCOPE_EXIT {
+                        for (auto &pattern : patterns) {
+                            if (localVariable) {
+                                wolv::util::unused(arrayVarDeclNode->execute(this));
 
-                            if (localVariable)
-                                this->popSectionId();
-                        };
-
-                        arrayVarDeclNode->createPatterns(this, patterns);
-                    } else if (auto pointerVarDecl = dynamic_cast<ast::ASTNodePointerVariableDecl *>(node); pointerVarDecl != nullptr) {
-                        std::vector<std::shared_ptr<ptrn::Pattern>> patterns;
-
-                        ON_SCOPE_EXIT {
-                            for (auto &pattern : patterns) {
-                                if (pointerVarDecl->getPlacementOffset() == nullptr) {
-                                    err::E0003.throwError("Pointers cannot be used as local variables.");
-                                } else {
-                                    this->m_patterns.push_back(std::move(pattern));
-                                }
+                                this->setBitwiseReadOffset(startOffset);
+                            } else {
+                                this->m_patterns.push_back(std::move(pattern));
                             }
-                        };
-
-                        pointerVarDecl->createPatterns(this, patterns);
-                    } else if (auto controlFlowStatement = dynamic_cast<ast::ASTNodeControlFlowStatement *>(node); controlFlowStatement != nullptr) {
-                        this->pushSectionId(ptrn::Pattern::HeapSectionId);
-                        auto result = node->execute(this);
-                        this->popSectionId();
+                        }
 
-                        if (result.has_value()) {
-                            this->m_mainResult = result;
+                        if (localVariable)
+                            this->popSectionId();
+                    };
+
+                    arrayVarDeclNode->createPatterns(this, patterns);
+                } else if (auto pointerVarDecl = dynamic_cast<ast::ASTNodePointerVariableDecl *>(node); pointerVarDecl != nullptr) {
+                    std::vector<std::shared_ptr<ptrn::Pattern>> patterns;
+
+                    ON_SCOPE_EXIT {
+                        for (auto &pattern : patterns) {
+                            if (pointerVarDecl->getPlacementOffset() == nullptr) {
+                                err::E0003.throwError("Pointers cannot be used as local variables.");
+                            } else {
+                                this->m_patterns.push_back(std::move(pattern));
+                            }
                         }
+                    };
 
-                        goto stop_evaluation;
-                    } else {
-                        this->pushSectionId(ptrn::Pattern::HeapSectionId);
-                        wolv::util::unused(node->execute(this));
-                        this->popSectionId();
+                    pointerVarDecl->createPatterns(this, patterns);
+                } else if (auto controlFlowStatement = dynamic_cast<ast::ASTNodeControlFlowStatement *>(node); controlFlowStatement != nullptr) {
+                    this->pushSectionId(ptrn::Pattern::HeapSectionId);
+                    auto result = node->execute(this);
+                    this->popSectionId();
+
+                    if (result.has_value()) {
+                        this->m_mainResult = result;
                     }
 
-                    if (this->getCurrentControlFlowStatement() == ControlFlowStatement::Return)
-                        goto stop_evaluation;
-                    else
-                        this->setCurrentControlFlowStatement(ControlFlowStatement::None);
+                    goto stop_evaluation;
+                } else {
+                    this->pushSectionId(ptrn::Pattern::HeapSectionId);
+                    wolv::util::unused(node->execute(this));
+                    this->popSectionId();
                 }
+
+                if (this->getCurrentControlFlowStatement() == ControlFlowStatement::Return)
+                    goto stop_evaluation;
+                else
+                    this->setCurrentControlFlowStatement(ControlFlowStatement::None);
             }
 
             stop_evaluation:
@@ -1238,7 +1780,7 @@ namespace pl::core {
         return true;
     }
 
-    Evaluator::UpdateHandler::UpdateHandler(Evaluator *evaluator, const ast::ASTNode *node) : evaluator(evaluator) {
+    void Evaluator::UpdateHandler::enter(const ast::ASTNode *node) {
         if (evaluator->m_evaluated)
             return;
 
@@ -1265,17 +1807,12 @@ namespace pl::core {
         }
     }
 
-    Evaluator::UpdateHandler::~UpdateHandler() {
+    void Evaluator::UpdateHandler::unwind() {
         if (evaluator->m_evaluated)
             return;
 
-        if (std::uncaught_exceptions() > 0) [[unlikely]]
-            if (node != nullptr)
-                evaluator->m_callStack.emplace_back(node->clone(), offset);
-    }
-
-    Evaluator::UpdateHandler Evaluator::updateRuntime(const ast::ASTNode *node) {
-        return { this, node };
+        if (node != nullptr)
+            evaluator->m_callStack.push_back({ node->getLocation(), node, offset });
     }
 
     void Evaluator::addBreakpoint(u32 line) { this->m_breakpoints.insert(line); }
@@ -1293,59 +1830,78 @@ namespace pl::core {
     void Evaluator::patternCreated(ptrn::Pattern *pattern) {
         this->m_lastPatternAddress = pattern->getOffset();
 
-        if (this->m_patternLimit > 0 && this->m_currPatternCount > this->m_patternLimit && !this->m_evaluated)
+        const auto patternCount = this->m_patternCounter->fetch_add(1);
+        if (this->m_patternLimit > 0 && patternCount > this->m_patternLimit && !this->m_evaluated) {
+            *this->m_patternCounter -= 1;
             err::E0007.throwError(fmt::format("Pattern count exceeded set limit of '{}'.", this->getPatternLimit()), "If this is intended, try increasing the limit using '#pragma pattern_limit <new_limit>'.");
-        this->m_currPatternCount += 1;
+        }
 
         // Make sure we don't throw an error if we're already in an error state
         if (std::uncaught_exceptions() != 0)
             return;
 
         if (pattern->isPatternLocal()) {
-            if (auto it = this->m_patternLocalStorage.find(pattern->getHeapAddress()); it != this->m_patternLocalStorage.end()) {
-                auto &[key, data] = *it;
-
-                data.referenceCount++;
-            } else {
-                this->m_patternLocalStorage[pattern->getHeapAddress()] = { 1, {} };
-            }
+            this->m_patternLocalStorage.getOrCreate(pattern->getHeapAddress()).referenceCount++;
         } else if (pattern->getSection() == ptrn::Pattern::HeapSectionId) {
-            this->m_heapReferenceCounts[pattern->getHeapAddress()]++;
+            const auto address = pattern->getHeapAddress();
+            if (address >= this->m_heapReferenceCounts.size())
+                this->m_heapReferenceCounts.resize(address + 1);
+
+            this->m_heapReferenceCounts[address]++;
         }
     }
 
+    void Evaluator::releasePatterns(const std::function<void()> &release) {
+        this->m_releasingPatterns = true;
+        ON_SCOPE_EXIT { this->m_releasingPatterns = false; };
+
+        if (release)
+            release();
+
+        this->m_patterns.clear();
+        this->m_scopes.clear();
+        this->m_typeLayoutCache.clear();
+        this->m_pointeeTables.clear();
+        this->m_attributedPatterns.clear();
+        this->m_patternLocalStorage.clear();
+        this->m_heapReferenceCounts.clear();
+
+        // Patterns still referenced from elsewhere keep the arena alive through their allocator
+        this->m_patternArena.reset();
+    }
+
     void Evaluator::patternDestroyed(ptrn::Pattern *pattern) {
-        this->m_currPatternCount -= 1;
+        *this->m_patternCounter -= 1;
+
+        if (this->m_releasingPatterns)
+            return;
 
         // Make sure we don't throw an error if we're already in an error state
         if (std::uncaught_exceptions() != 0)
             return;
 
-        const auto &attributes = pattern->getAttributes();
-        if (attributes != nullptr) {
-            for (const auto &[attribute, args] : *attributes) {
+        for (AttributeId attribute = 0; pattern->m_attributeFlags != 0 && attribute < attr::FlagCount; attribute++) {
+            if (pattern->m_attributeFlags & (1U << attribute))
                 this->removeAttributedPattern(attribute, pattern);
-            }
         }
 
-        if (pattern->isPatternLocal()) {
-            if (auto it = this->m_patternLocalStorage.find(pattern->getHeapAddress()); it != this->m_patternLocalStorage.end()) {
-                auto &[key, data] = *it;
+        if (pattern->m_coldData != nullptr) {
+            for (const auto attribute : pattern->m_coldData->attributeIds)
+                this->removeAttributedPattern(attribute, pattern);
+        }
 
-                data.referenceCount--;
-                if (data.referenceCount == 0)
-                    this->m_patternLocalStorage.erase(it);
+        if (pattern->isPatternLocal()) {
+            if (auto cell = this->m_patternLocalStorage.find(pattern->getHeapAddress()); cell != nullptr) {
+                cell->referenceCount--;
+                if (cell->referenceCount == 0)
+                    this->m_patternLocalStorage.release(pattern->getHeapAddress());
             } else if (!this->m_evaluated) {
                 err::E0001.throwError(fmt::format("Double free of variable named '{}'.", pattern->getVariableName()));
             }
         } else if (pattern->getSection() == ptrn::Pattern::HeapSectionId) {
-            if (auto it = this->m_heapReferenceCounts.find(pattern->getHeapAddress()); it != this->m_heapReferenceCounts.end()) {
-                auto &[address, referenceCount] = *it;
-
-                referenceCount--;
-                if (referenceCount == 0)
-                    this->m_heapReferenceCounts.erase(it);
-            }
+            const auto address = pattern->getHeapAddress();
+            if (address < this->m_heapReferenceCounts.size() && this->m_heapReferenceCounts[address] > 0)
+                this->m_heapReferenceCounts[address]--;
         }
     }
 
@@ -3,7 +3,11 @@
 #include <pl/helpers/utils.hpp>
 #include <pl/api.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <optional>
+#include <set>
 #include <wolv/utils/charconv.hpp>
 
 namespace pl::core {
@@ -11,16 +15,166 @@ namespace pl::core {
 
     static constexpr char integerSeparator = '\'';
 
+    enum CharacterClass : u8 {
+        Letter      = 1 << 0,
+        Digit       = 1 << 1,
+        HexDigit    = 1 << 2,
+        Whitespace  = 1 << 3
+    };
+
+    // Classifies every possible byte once instead of going through the locale dependent <cctype> functions
+    static constexpr auto CharacterClasses = [] {
+        std::array<u8, 256> classes = { };
+        for (u32 c = 0; c < classes.size(); c += 1) {
+            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_')
+                classes[c] |= Letter;
+            if (c >= '0' && c <= '9')
+                classes[c] |= Digit | HexDigit;
+            if ((c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))
+                classes[c] |= HexDigit;
+            if (c == ' ' || (c >= '\t' && c <= '\r'))
+                classes[c] |= Whitespace;
+        }
+
+        return classes;
+    }();
+
+    static constexpr bool hasCharacterClass(const char c, const u8 characterClass) {
+        return (CharacterClasses[static_cast<u8>(c)] & characterClass) != 0;
+    }
+
     static bool isIdentifierCharacter(const char c) {
-        return std::isalnum(c) || c == '_';
+        return hasCharacterClass(c, Letter | Digit);
+    }
+
+    /**
+     * @brief Lookup table for a fixed set of strings
+     * @note The hash seed is chosen while building the table so that every key gets a slot of its own, a lookup is a single hash and compare
+     */
+    class PerfectHashTable {
+    public:
+        explicit PerfectHashTable(const std::vector<std::pair<std::string_view, Token>> &entries) {
+            // Earlier entries take precedence over later ones with the same key
+            std::set<std::string_view> keys;
+            for (const auto &[key, token] : entries) {
+                if (keys.insert(key).second) {
+                    this->m_keys.push_back(key);
+                    this->m_tokens.push_back(token);
+                }
+            }
+
+            auto size = std::bit_ceil(std::max<size_t>(this->m_keys.size() * 4, 1));
+            while (!this->tryBuild(size))
+                size *= 2;
+        }
+
+        [[nodiscard]] const Token* find(std::string_view key) const {
+            const auto index = this->m_slots[hash(key, this->m_seed) & this->m_mask];
+            if (index == 0 || this->m_keys[index - 1] != key)
+                return nullptr;
+
+            return &this->m_tokens[index - 1];
+        }
+
+    private:
+        constexpr static u64 MaxSeedAttempts = 0x1000;
+
+        static u64 hash(std::string_view key, u64 seed) {
+            u64 hash = 0xCBF29CE484222325 ^ (seed * 0x9E3779B97F4A7C15);
+            for (const auto c : key) {
+                hash ^= static_cast<u8>(c);
+                hash *= 0x100000001B3;
+            }
+
+            return hash ^ (hash >> 32);
+        }
+
+        bool tryBuild(size_t size) {
+            std::vector<u32> slots(size);
+            for (u64 seed = 0; seed < MaxSeedAttempts; seed += 1) {
+                std::ranges::fill(slots, 0);
+
+                bool collision = false;
+                for (u32 i = 0; i < this->m_keys.size(); i += 1) {
+                    auto &slot = slots[hash(this->m_keys[i], seed) & (size - 1)];
+                    if (slot != 0) {
+                        collision = true;
+                        break;
+                    }
+
+                    slot = i + 1;
+                }
+
+                if (!collision) {
+                    this->m_slots = std::move(slots);
+                    this->m_seed = seed;
+                    this->m_mask = size - 1;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        std::vector<std::string_view> m_keys;
+        std::vector<Token> m_tokens;
+        std::vector<u32> m_slots;
+        u64 m_seed = 0, m_mask = 0;
+    };
+
+    // Keywords, named operators, types and constants, in the order the lexer used to try them
+    static const PerfectHashTable& getWordTable() {
+        static const PerfectHashTable table = [] {
+            std::vector<std::pair<std::string_view, Token>> entries;
+            for (const auto &entry : Token::Keywords())
+                entries.emplace_back(entry);
+            for (const auto &[name, token] : Token::Operators()) {
+                if (isIdentifierCharacter(name.front()))
+                    entries.emplace_back(name, token);
+            }
+            for (const auto &entry : Token::Types())
+                entries.emplace_back(entry);
+            for (const auto &[name, value] : constants)
+                entries.emplace_back(name, Literal::makeNumeric(value));
+
+            return PerfectHashTable(entries);
+        }();
+
+        return table;
+    }
+
+    static const PerfectHashTable& getOperatorTable() {
+        static const PerfectHashTable table = [] {
+            std::vector<std::pair<std::string_view, Token>> entries;
+            for (const auto &[name, token] : Token::Operators()) {
+                if (!isIdentifierCharacter(name.front()))
+                    entries.emplace_back(name, token);
+            }
+
+            return PerfectHashTable(entries);
+        }();
+
+        return table;
+    }
+
+    static const std::array<const Token*, 256>& getSeparatorTable() {
+        static const auto table = [] {
+            std::array<const Token*, 256> separators = { };
+            for (const auto &[character, token] : Token::Separators())
+                separators[static_cast<u8>(character)] = &token;
+
+            return separators;
+        }();
+
+        return table;
     }
 
     static bool isIntegerCharacter(const char c, const int base) {
         switch (base) {
             case 16:
-                return std::isxdigit(c);
+                return hasCharacterClass(c, HexDigit);
             case 10:
-                return std::isdigit(c);
+                return hasCharacterClass(c, Digit);
             case 8:
                 return c >= '0' && c <= '7';
             case 2:
@@ -60,9 +214,11 @@ namespace pl::core {
             return std::nullopt;
         }
 
-        const char& c = m_sourceCode[m_cursor++];
+        const char c = m_sourceCode[m_cursor++];
         if (c == '\\') {
-            switch (m_sourceCode[m_cursor++]) {
+            const char escape = peek(0);
+            m_cursor++;
+            switch (escape) {
                 case 'a':
                     return '\a';
                 case 'b':
@@ -84,7 +240,7 @@ namespace pl::core {
                 case '\\':
                     return '\\';
                 case 'x': {
-                    const char hex[3] = { m_sourceCode[m_cursor], m_sourceCode[m_cursor + 1], 0 };
+                    const char hex[3] = { peek(0), peek(1), 0 };
                     m_cursor += 2;
                     try {
                         return static_cast<char>(std::stoul(hex, nullptr, 16));
@@ -95,8 +251,7 @@ namespace pl::core {
                     }
                 }
                 case 'u': {
-                    const char hex[5] = { m_sourceCode[m_cursor], m_sourceCode[m_cursor + 1], m_sourceCode[m_cursor + 2],
-                                    m_sourceCode[m_cursor + 3], 0 };
+                    const char hex[5] = { peek(0), peek(1), peek(2), peek(3), 0 };
                     m_cursor += 4;
                     try {
                         return static_cast<char>(std::stoul(hex, nullptr, 16));
@@ -108,7 +263,7 @@ namespace pl::core {
                 }
                 default:
                     m_errorLength = 1;
-                    error("Unknown escape sequence: {}", m_sourceCode[m_cursor-1]);
+                    error("Unknown escape sequence: {}", escape);
                 return std::nullopt;
             }
         }
@@ -131,7 +286,7 @@ namespace pl::core {
         m_cursor++; // Skip space
         auto location = this->location();
 
-        while (!std::isblank(m_sourceCode[m_cursor]) && !std::isspace(m_sourceCode[m_cursor]) && m_sourceCode[m_cursor] != '\0' ) {
+        while (!hasCharacterClass(peek(0), Whitespace) && peek(0) != '\0') {
 
             auto character = parseCharacter();
             if (!character.has_value()) {
@@ -141,7 +296,7 @@ namespace pl::core {
             result += character.value();
         }
 
-        if (hasTheLineEnded(m_sourceCode[m_cursor]))
+        if (hasTheLineEnded(peek(0)))
             m_cursor++;
 
         return makeTokenAt(Literal::makeString(result), location, result.size());
@@ -153,7 +308,7 @@ namespace pl::core {
         m_cursor++; // Skip space
         auto location = this->location();
 
-        while (m_sourceCode[m_cursor] != '\n' && m_sourceCode[m_cursor] != '\r' && m_sourceCode[m_cursor] != '\0') {
+        while (peek(0) != '\n' && peek(0) != '\r' && peek(0) != '\0') {
 
             auto character = parseCharacter();
             if (!character.has_value()) {
@@ -163,7 +318,7 @@ namespace pl::core {
             result += character.value();
         }
 
-        if (hasTheLineEnded(m_sourceCode[m_cursor]))
+        if (hasTheLineEnded(peek(0)))
             m_cursor++;
 
         return makeTokenAt(Literal::makeString(result), location, result.size());
@@ -175,7 +330,15 @@ namespace pl::core {
 
         m_cursor++; // Skip opening "
 
-        while (m_sourceCode[m_cursor] != '\"') {
+        // Strings without escape sequences can be taken from the source as a whole
+        if (const auto end = m_sourceCode.find_first_of(std::string_view("\"\\\n\r\0", 5), m_cursor); end != std::string_view::npos && m_sourceCode[end] == '\"') {
+            result = m_sourceCode.substr(m_cursor, end - m_cursor);
+            m_cursor = end + 1;
+
+            return makeTokenAt(Literal::makeString(result), location, result.size() + 2);
+        }
+
+        while (peek(0) != '\"') {
             char c = peek(0);
             if (c == '\n' || c == '\r') {
                 m_errorLength = 1;
@@ -314,16 +477,14 @@ namespace pl::core {
     std::optional<Token> Lexer::parseOneLineComment() {
         auto location = this->location();
         const auto begin = m_cursor;
-        m_cursor += 2;
+        m_cursor = std::min(m_cursor + 2, m_sourceCode.size());
 
-        std::string result;
-        while(m_sourceCode[m_cursor] != '\n' && m_sourceCode[m_cursor] != '\r' && m_sourceCode[m_cursor] != '\0') {
-            result += m_sourceCode[m_cursor];
-            m_cursor++;
-        }
+        const auto end = std::min(m_sourceCode.find_first_of(std::string_view("\n\r\0", 3), m_cursor), m_sourceCode.size());
+        std::string result(m_sourceCode.substr(m_cursor, end - m_cursor));
+        m_cursor = end;
         auto len = m_cursor - begin;
 
-        if (hasTheLineEnded(m_sourceCode[m_cursor]))
+        if (hasTheLineEnded(peek(0)))
             m_cursor++;
 
         return makeTokenAt(Literal::makeComment(true, result), location, len);
@@ -332,16 +493,14 @@ namespace pl::core {
     std::optional<Token> Lexer::parseOneLineDocComment() {
         auto location = this->location();
         const auto begin = m_cursor;
-        m_cursor += 3;
+        m_cursor = std::min(m_cursor + 3, m_sourceCode.size());
 
-        std::string result;
-        while(m_sourceCode[m_cursor] != '\n' && m_sourceCode[m_cursor] != '\r' && m_sourceCode[m_cursor] != '\0') {
-            result += m_sourceCode[m_cursor];
-            m_cursor++;
-        }
+        const auto end = std::min(m_sourceCode.find_first_of(std::string_view("\n\r\0", 3), m_cursor), m_sourceCode.size());
+        std::string result(m_sourceCode.substr(m_cursor, end - m_cursor));
+        m_cursor = end;
         auto len = m_cursor - begin;
 
-        if (hasTheLineEnded(m_sourceCode[m_cursor]))
+        if (hasTheLineEnded(peek(0)))
             m_cursor++;
 
         return makeTokenAt(Literal::makeDocComment(false, true, result), location, len);
@@ -368,7 +527,8 @@ namespace pl::core {
                 break;
             }
 
-            result += m_sourceCode[m_cursor++];
+            result += peek(0);
+            m_cursor++;
         }
 
         return makeTokenAt(Literal::makeDocComment(global, false, result), location, m_cursor - begin);
@@ -394,7 +554,8 @@ namespace pl::core {
                 break;
             }
 
-            result += m_sourceCode[m_cursor++];
+            result += peek(0);
+            m_cursor++;
         }
 
         return makeTokenAt(Literal::makeComment(false, result), location, m_cursor - begin);
@@ -402,61 +563,33 @@ namespace pl::core {
 
     std::optional<Token> Lexer::parseOperator() {
         auto location = this->location();
-        const auto begin = m_cursor;
-        const auto operators = Token::Operators();
-        std::optional<Token> lastMatch = std::nullopt;
+        const auto &operators = getOperatorTable();
 
-        for (int i = 1; i <= Operator::maxOperatorLength; ++i) {
-            const auto view = std::string_view { &m_sourceCode[begin], static_cast<size_t>(i) };
-            if (auto operatorToken = operators.find(view); operatorToken != operators.end()) {
-                m_cursor++;
-                lastMatch = operatorToken->second;
+        // Longest match first, never looking past the end of the source
+        for (size_t length = std::min<size_t>(Operator::maxOperatorLength, m_sourceCode.size() - m_cursor); length > 0; length -= 1) {
+            if (const auto operatorToken = operators.find(m_sourceCode.substr(m_cursor, length)); operatorToken != nullptr) {
+                m_cursor += length;
+                return makeTokenAt(*operatorToken, location, length);
             }
         }
 
-        return lastMatch ? makeTokenAt(lastMatch.value(), location, m_cursor - begin) : lastMatch;
+        return std::nullopt;
     }
 
     std::optional<Token> Lexer::parseSeparator() {
         auto location = this->location();
-        const auto begin = m_cursor;
 
-        if (const auto separatorToken = Token::Separators().find(m_sourceCode[m_cursor]);
-            separatorToken != Token::Separators().end()) {
+        if (const auto separatorToken = getSeparatorTable()[static_cast<u8>(peek(0))]; separatorToken != nullptr) {
             m_cursor++;
-            return makeTokenAt(separatorToken->second, location, m_cursor - begin);
-            }
-
-        return std::nullopt;
-    }
-
-    std::optional<Token> Lexer::parseKeyword(const std::string_view &identifier) {
-        const auto keywords = Token::Keywords();
-        if (const auto keywordToken = keywords.find(identifier); keywordToken != keywords.end()) {
-            return makeToken(keywordToken->second, identifier.length());
+            return makeTokenAt(*separatorToken, location, 1);
         }
-        return std::nullopt;
-    }
 
-    std::optional<Token> Lexer::parseType(const std::string_view &identifier) {
-        auto types = Token::Types();
-        if (const auto typeToken = types.find(identifier); typeToken != types.end()) {
-            return makeToken(typeToken->second, identifier.length());
-        }
         return std::nullopt;
     }
 
-    std::optional<Token> Lexer::parseNamedOperator(const std::string_view &identifier) {
-        auto operators = Token::Operators();
-        if (const auto operatorToken = operators.find(identifier); operatorToken != operators.end()) {
-            return makeToken(operatorToken->second, identifier.length());
-        }
-        return std::nullopt;
-    }
-
-    std::optional<Token> Lexer::parseConstant(const std::string_view &identifier) {
-        if (const auto constantToken = constants.find(identifier); constantToken != constants.end()) {
-            return makeToken(Literal::makeNumeric(constantToken->second), identifier.length());
+    std::optional<Token> Lexer::parseWord(const std::string_view &identifier) {
+        if (const auto wordToken = getWordTable().find(identifier); wordToken != nullptr) {
+            return makeToken(*wordToken, identifier.length());
         }
         return std::nullopt;
     }
@@ -482,37 +615,44 @@ namespace pl::core {
 
         this->reset();
 
+        // The main source is usually being edited, only included sources are worth caching
+        const bool cacheable = this->m_tokenCache.has_value() && !source->mainSource;
+        if (cacheable) {
+            if (auto entry = this->m_tokenCache->load(source); entry.has_value()) {
+                this->m_longestLineLength = entry->longestLineLength;
+                this->m_tokens = std::move(entry->tokens);
+
+                return { this->m_tokens, {} };
+            }
+        }
+
         const size_t end = this->m_sourceCode.size();
 
         while (this->m_cursor < end) {
-            const char& c = this->m_sourceCode[this->m_cursor];
+            const char c = this->m_sourceCode[this->m_cursor];
 
             if (c == '\x00') {
                 m_longestLineLength = std::max(m_longestLineLength, m_cursor - m_lineBegin);
                 break; // end of string
             }
 
-            if (std::isblank(c) || std::isspace(c)) {
+            if (hasCharacterClass(c, Whitespace)) {
                 hasTheLineEnded(c);
                 m_cursor++;
                 continue;
             }
 
-            if(isIdentifierCharacter(c) && !std::isdigit(c)) {
+            if(hasCharacterClass(c, Letter)) {
                 size_t length = 0;
                 while (isIdentifierCharacter(peek(length))) {
                     length++;
                 }
 
-                auto identifier = std::string_view { &m_sourceCode[m_cursor], length };
+                auto identifier = m_sourceCode.substr(m_cursor, length);
 
-                // process keywords, named operators and types
-                if (processToken(&Lexer::parseKeyword, identifier) ||
-                    processToken(&Lexer::parseNamedOperator, identifier) ||
-                    processToken(&Lexer::parseType, identifier) ||
-                    processToken(&Lexer::parseConstant, identifier)) {
+                // process keywords, named operators, types and constants
+                if (processToken(&Lexer::parseWord, identifier))
                     continue;
-                    }
 
                 // not a predefined token, so it must be an identifier
                 addToken(makeToken(Literal::makeIdentifier(std::string(identifier)), length));
@@ -521,11 +661,11 @@ namespace pl::core {
                 continue;
             }
 
-            if(std::isdigit(c)) {
-                auto literal = &m_sourceCode[m_cursor];
+            if(hasCharacterClass(c, Digit)) {
+                auto literal = m_sourceCode.substr(m_cursor);
                 size_t size = getIntegerLiteralLength(literal);
 
-                const auto integer = parseIntegerLiteral({ literal, size });
+                const auto integer = parseIntegerLiteral(literal.substr(0, size));
 
                 if(integer.has_value()) {
                     addToken(makeToken(Literal::makeNumeric(integer.value()), size));
@@ -587,7 +727,7 @@ namespace pl::core {
                 u32 line = m_line;
                 while (isIdentifierCharacter(peek(length)))
                     length++;
-                auto directiveName = std::string_view{&m_sourceCode[m_cursor], length};
+                auto directiveName = m_sourceCode.substr(m_cursor, length);
 
                 if (processToken(&Lexer::parseDirectiveName, directiveName)) {
                     Token::Directive directive = get<Token::Directive>(m_tokens.back().value);
@@ -632,7 +772,7 @@ namespace pl::core {
                 const auto character = parseCharacter();
 
                 if (character.has_value()) {
-                    if(m_sourceCode[m_cursor] != '\'') {
+                    if(peek(0) != '\'') {
                         m_errorLength = 1;
                         error("Expected closing '");
                         continue;
@@ -656,7 +796,11 @@ namespace pl::core {
         m_longestLineLength = std::max(m_longestLineLength, m_cursor - m_lineBegin);
         addToken(makeToken(Separator::EndOfProgram, 0));
 
-        return { m_tokens, collectErrors() };
+        auto errors = collectErrors();
+        if (cacheable && errors.empty())
+            this->m_tokenCache->store(source, { m_tokens, m_longestLineLength });
+
+        return { m_tokens, std::move(errors) };
     }
 
     void Lexer::reset() {
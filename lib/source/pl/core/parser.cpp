@@ -150,13 +150,8 @@ namespace pl::core {
                     typeName += "::";
                     continue;
                 }
-                if (this->m_types.contains(typeName))
-                    return create<ast::ASTNodeScopeResolution>(std::shared_ptr<ast::ASTNodeTypeDecl>(this->m_types[typeName].unwrap()), getValue<Token::Identifier>(-1).get());
-                for (auto &potentialName : getNamespacePrefixedNames(typeName)) {
-                    if (this->m_types.contains(potentialName)) {
-                        return create<ast::ASTNodeScopeResolution>(std::shared_ptr<ast::ASTNodeTypeDecl>(this->m_types[potentialName].unwrap()), getValue<Token::Identifier>(-1).get());
-                    }
-                }
+                if (auto type = resolveType(typeName); type != nullptr)
+                    return create<ast::ASTNodeScopeResolution>(std::shared_ptr<ast::ASTNodeTypeDecl>(type->unwrap()), getValue<Token::Identifier>(-1).get());
 
                 error("No namespace with this name found.");
                 return nullptr;
@@ -809,7 +804,7 @@ namespace pl::core {
             unwrappedParams.emplace_back(std::move(name), std::move(node.unwrap()));
         }
 
-        return create<ast::ASTNodeFunctionDefinition>(getNamespacePrefixedNames(functionName).back(), std::move(unwrappedParams), unwrapSafePointerVector(std::move(body)), parameterPack, unwrapSafePointerVector(std::move(defaultParameters)));
+        return create<ast::ASTNodeFunctionDefinition>(this->m_types.getQualifiedName(getCurrentScope(), functionName), std::move(unwrappedParams), unwrapSafePointerVector(std::move(body)), parameterPack, unwrapSafePointerVector(std::move(defaultParameters)));
     }
 
     hlp::safe_unique_ptr<ast::ASTNode> Parser::parseArrayInitExpression(std::string identifier) {
@@ -1331,19 +1326,17 @@ namespace pl::core {
             }
         }
 
-        for (const auto &typeName : getNamespacePrefixedNames(baseTypeName)) {
-            if (this->m_types.contains(typeName)) {
-                auto type = this->m_types[typeName];
-
-                if (type == nullptr)
-                    return nullptr;
+        if (auto resolvedType = resolveType(baseTypeName); resolvedType != nullptr) {
+            auto type = *resolvedType;
 
-                if (type->isValid() && type->getType() == nullptr) {
-                    return nullptr;
-                }
+            if (type == nullptr)
+                return nullptr;
 
-                return create<ast::ASTNodeTypeApplication>(type.unwrapUnchecked());
+            if (type->isValid() && type->getType() == nullptr) {
+                return nullptr;
             }
+
+            return create<ast::ASTNodeTypeApplication>(type.unwrapUnchecked());
         }
 
         return nullptr;
@@ -1551,7 +1544,7 @@ namespace pl::core {
 
         // Merge type definitions together
         for (auto &[typeName, typeDecl] : parsedData.value().types)
-            this->m_types[typeName] = std::move(typeDecl);
+            this->m_types.set(typeName, std::move(typeDecl));
 
         // Use ast in a virtual compound statement
         return create<ast::ASTNodeCompoundStatement>(std::move(parsedData.value().astNodes), false);
@@ -1567,17 +1560,16 @@ namespace pl::core {
 
         if (!sequence(tkn::Operator::Assign)) {
             // Forward declaration
-            auto typeName = getNamespacePrefixedNames(name).back();
             if (typedefIdentifier != nullptr)
                 typedefIdentifier->setType(Token::Identifier::IdentifierType::UDT);
 
-            if (this->m_types.contains(name)) {
+            if (this->m_types.find(name) != nullptr) {
                 return nullptr;
             }
 
             auto typeDecl = createShared<ast::ASTNodeTypeDecl>(name);
             typeDecl->setTemplateParameters(unwrapSafePointerVector(std::move(templateList)));
-            this->m_types.insert({ typeName, typeDecl });
+            this->m_types.emplace(getCurrentScope(), name, typeDecl);
             return nullptr;
         }
 
@@ -2565,7 +2557,7 @@ namespace pl::core {
 
         std::string name;
         while (true) {
-            this->m_currNamespace.back().push_back(getValue<Token::Identifier>(-1).get());
+            this->m_currNamespace.back().push_back(this->m_types.getScope(getCurrentScope(), getValue<Token::Identifier>(-1).get()));
             name += getValue<Token::Identifier>(-1).get();
 
             auto identifier = std::get_if<Token::Identifier>(&((m_curr[-1]).value));
@@ -2722,19 +2714,21 @@ namespace pl::core {
     }
 
     hlp::safe_shared_ptr<ast::ASTNodeTypeDecl> Parser::addType(const std::string &name, hlp::safe_unique_ptr<ast::ASTNode> &&node) {
-        auto typeName = getNamespacePrefixedNames(name).back();
+        const auto scope = getCurrentScope();
+        auto existingType = this->m_types.find(scope, name);
 
-        if (this->m_types.contains(typeName) && this->m_types.at(typeName)->isForwardDeclared()) {
+        if (existingType != nullptr && (*existingType)->isForwardDeclared()) {
             if(node != nullptr) {
-                this->m_types.at(typeName)->setType(std::move(node));
+                (*existingType)->setType(std::move(node));
             }
 
-            return this->m_types.at(typeName);
+            return *existingType;
         }
 
-        if (!this->m_types.contains(typeName)) {
+        const auto typeName = this->m_types.getQualifiedName(scope, name);
+        if (existingType == nullptr) {
             auto typeDecl = createShared<ast::ASTNodeTypeDecl>(typeName, std::move(std::move(node).unwrapUnchecked()));
-            this->m_types.insert({typeName, typeDecl});
+            this->m_types.emplace(scope, name, typeDecl);
 
             return typeDecl;
         }
@@ -2801,8 +2795,11 @@ namespace pl::core {
 
         this->reset();
 
-        if (!this->m_aliasNamespace.empty())
-            this->m_currNamespace.push_back(this->m_aliasNamespace);
+        if (!this->m_aliasNamespace.empty()) {
+            auto &scopes = this->m_currNamespace.emplace_back();
+            for (const auto &part : this->m_aliasNamespace)
+                scopes.push_back(this->m_types.getScope(scopes.empty() ? TypeTable::GlobalScope : scopes.back(), part));
+        }
 
         for (const auto &[name, type] : m_parserManager->getBuiltinTypes())
             this->m_types.emplace(name, type);
@@ -549,6 +549,11 @@ namespace pl::core {
     }
 
 
+    void Preprocessor::appendToPragmas(const Preprocessor &other) {
+        for (const auto &[type, values] : other.m_pragmas)
+            std::ranges::copy(values, std::back_inserter(this->m_pragmas[type]));
+    }
+
     void Preprocessor::appendToNamespaces(std::vector<Token> tokens) {
         for (auto token = tokens.begin(); token != tokens.end(); token++ ) {
             u32 idx = 1;
@@ -36,23 +36,47 @@ namespace pl::core::resolvers {
             if(!exists)
                 continue;
 
-            auto file = wolv::io::File(fullPath, wolv::io::File::Mode::Read);
-
             const auto utf8 = wolv::util::toUTF8String(fullPath);
-            if (!file.isValid()) {
-                return Result::err("Could not open file " + utf8);
-            }
-
             if (!std::fs::is_regular_file(fullPath)) {
                 return Result::err("Path " + utf8 + " is not a regular file");
             }
 
-            auto content = file.readString();
-            content = wolv::util::replaceStrings(content, "\r\n", "\n");
+            auto content = this->readFile(fullPath);
+            if (content == nullptr) {
+                return Result::err("Could not open file " + utf8);
+            }
 
-            return Result::good(api::Source(content, utf8, false));
+            return Result::good(api::Source(std::move(content), utf8, false));
         }
 
         return Result::err("Could not find file " + path);
     }
+
+    std::shared_ptr<const std::string> FileResolver::readFile(const std::fs::path &path) const {
+        std::error_code error;
+        auto canonicalPath = std::fs::canonical(path, error);
+        if (error)
+            canonicalPath = path;
+
+        const auto lastWriteTime = std::fs::last_write_time(path, error);
+        const auto size = error ? 0 : std::fs::file_size(path, error);
+
+        // Files are read again only once they changed on disk, otherwise all sources share the same buffer
+        if (!error) {
+            if (auto it = this->m_fileCache.find(canonicalPath); it != this->m_fileCache.end()) {
+                if (it->second.lastWriteTime == lastWriteTime && it->second.size == size)
+                    return it->second.content;
+            }
+        }
+
+        auto file = wolv::io::File(path, wolv::io::File::Mode::Read);
+        if (!file.isValid())
+            return nullptr;
+
+        auto content = std::make_shared<const std::string>(wolv::util::replaceStrings(file.readString(), "\r\n", "\n"));
+        if (!error)
+            this->m_fileCache.insert_or_assign(canonicalPath, CachedFile { lastWriteTime, size, content });
+
+        return content;
+    }
 }
@@ -0,0 +1,284 @@
+#include <pl/core/token_cache.hpp>
+
+#include <wolv/io/file.hpp>
+#include <wolv/utils/core.hpp>
+
+#include <fmt/format.h>
+
+#include <cstring>
+#include <random>
+#include <type_traits>
+
+namespace pl::core {
+
+    namespace {
+
+        constexpr u32 Magic         = 0x43544C50; // "PLTC"
+        // Needs to be bumped whenever the layout of an entry or the tokens produced by the lexer change
+        constexpr u32 FormatVersion = 2;
+
+        u64 hashContent(std::string_view content) {
+            // FNV-1a, the hash needs to stay the same across processes and platforms
+            u64 hash = 0xCBF29CE484222325;
+            for (const auto c : content) {
+                hash ^= static_cast<u8>(c);
+                hash *= 0x100000001B3;
+            }
+
+            return hash;
+        }
+
+        class Writer {
+        public:
+            template<typename T> requires std::is_trivially_copyable_v<T>
+            void write(const T &value) {
+                const auto offset = this->m_buffer.size();
+                this->m_buffer.resize(offset + sizeof(T));
+                std::memcpy(this->m_buffer.data() + offset, &value, sizeof(T));
+            }
+
+            void write(const std::string &value) {
+                this->write<u64>(value.size());
+                this->m_buffer.insert(this->m_buffer.end(), value.begin(), value.end());
+            }
+
+            [[nodiscard]] const std::vector<u8>& getBuffer() const {
+                return this->m_buffer;
+            }
+
+        private:
+            std::vector<u8> m_buffer;
+        };
+
+        class Reader {
+        public:
+            explicit Reader(const std::vector<u8> &buffer) : m_buffer(buffer) { }
+
+            template<typename T> requires std::is_trivially_copyable_v<T>
+            bool read(T &value) {
+                if (this->m_offset + sizeof(T) > this->m_buffer.size())
+                    return false;
+
+                std::memcpy(&value, this->m_buffer.data() + this->m_offset, sizeof(T));
+                this->m_offset += sizeof(T);
+                return true;
+            }
+
+            bool read(std::string &value) {
+                u64 size = 0;
+                if (!this->read(size) || size > this->m_buffer.size() - this->m_offset)
+                    return false;
+
+                value.assign(reinterpret_cast<const char*>(this->m_buffer.data() + this->m_offset), size);
+                this->m_offset += size;
+                return true;
+            }
+
+        private:
+            const std::vector<u8> &m_buffer;
+            size_t m_offset = 0;
+        };
+
+        // Entries can be corrupted or come from another version, values outside of the enum are rejected instead of cast
+        template<typename T>
+        bool readEnum(Reader &reader, T &value, T last) {
+            u32 raw = 0;
+            if (!reader.read(raw) || raw > u32(last))
+                return false;
+
+            value = static_cast<T>(raw);
+            return true;
+        }
+
+        // Value types aren't numbered consecutively, every one of them needs to be checked
+        bool readValueType(Reader &reader, Token::ValueType &value) {
+            u32 raw = 0;
+            if (!reader.read(raw))
+                return false;
+
+            using enum Token::ValueType;
+            switch (Token::ValueType(raw)) {
+                case Unsigned8Bit: case Signed8Bit: case Unsigned16Bit: case Signed16Bit:
+                case Unsigned24Bit: case Signed24Bit: case Unsigned32Bit: case Signed32Bit:
+                case Unsigned48Bit: case Signed48Bit: case Unsigned64Bit: case Signed64Bit:
+                case Unsigned96Bit: case Signed96Bit: case Unsigned128Bit: case Signed128Bit:
+                case Character: case Character16: case Boolean: case Float: case Double:
+                case String: case Auto: case CustomType: case Padding:
+                case Unsigned: case Signed: case FloatingPoint: case Integer: case Any:
+                    value = Token::ValueType(raw);
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        bool writeLiteral(Writer &writer, const Token::Literal &literal) {
+            writer.write<u8>(literal.index());
+
+            return std::visit(wolv::util::overloaded {
+                [&](const std::string &value) { writer.write(value); return true; },
+                [](const std::shared_ptr<ptrn::Pattern> &) { return false; },
+                [&](const auto &value) { writer.write(value); return true; }
+            }, static_cast<const Token::LiteralVariantType&>(literal));
+        }
+
+        bool readLiteral(Reader &reader, Token::Literal &literal) {
+            u8 index = 0;
+            if (!reader.read(index))
+                return false;
+
+            const auto readValue = [&]<typename T>() {
+                T value = { };
+                if (!reader.read(value))
+                    return false;
+
+                literal = std::move(value);
+                return true;
+            };
+
+            switch (index) {
+                case 0: return readValue.operator()<char>();
+                case 1: return readValue.operator()<bool>();
+                case 2: return readValue.operator()<u128>();
+                case 3: return readValue.operator()<i128>();
+                case 4: return readValue.operator()<double>();
+                case 5: return readValue.operator()<std::string>();
+                default: return false;
+            }
+        }
+
+        bool writeToken(Writer &writer, const Token &token) {
+            writer.write<u8>(u8(token.type));
+            writer.write<u8>(token.value.index());
+
+            const bool valid = std::visit(wolv::util::overloaded {
+                [&](const Token::Identifier &value) { writer.write(value.get()); writer.write<u8>(u8(value.getType())); return true; },
+                [&](const Token::Literal &value) { return writeLiteral(writer, value); },
+                [&](const Token::Comment &value) { writer.write(value.singleLine); writer.write(value.comment); return true; },
+                [&](const Token::DocComment &value) { writer.write(value.global); writer.write(value.singleLine); writer.write(value.comment); return true; },
+                [&](const auto &value) { writer.write<u32>(u32(value)); return true; }
+            }, token.value);
+
+            writer.write(token.location.line);
+            writer.write(token.location.column);
+            writer.write<u64>(token.location.length);
+
+            return valid;
+        }
+
+        bool readToken(Reader &reader, const api::Source *source, Token &token) {
+            u8 type = 0, index = 0;
+            if (!reader.read(type) || !reader.read(index) || type > u8(Token::Type::Directive))
+                return false;
+
+            token.type = Token::Type(type);
+
+            bool valid = false;
+            switch (index) {
+                case 0: { Token::Keyword value = { }; valid = readEnum(reader, value, Token::Keyword::From); token.value = value; break; }
+                case 1: {
+                    std::string name;
+                    u8 identifierType = 0;
+                    valid = reader.read(name) && reader.read(identifierType) && identifierType <= u8(Token::Identifier::IdentifierType::PlacedVariable);
+                    token.value = Token::Identifier(std::move(name), Token::Identifier::IdentifierType(identifierType));
+                    break;
+                }
+                case 2: { Token::Operator value = { }; valid = readEnum(reader, value, Token::Operator::ScopeResolution); token.value = value; break; }
+                case 3: { Token::Literal value; valid = readLiteral(reader, value); token.value = std::move(value); break; }
+                case 4: { Token::ValueType value = { }; valid = readValueType(reader, value); token.value = value; break; }
+                case 5: { Token::Separator value = { }; valid = readEnum(reader, value, Token::Separator::EndOfProgram); token.value = value; break; }
+                case 6: {
+                    Token::Comment value = { };
+                    valid = reader.read(value.singleLine) && reader.read(value.comment);
+                    token.value = std::move(value);
+                    break;
+                }
+                case 7: {
+                    Token::DocComment value = { };
+                    valid = reader.read(value.global) && reader.read(value.singleLine) && reader.read(value.comment);
+                    token.value = std::move(value);
+                    break;
+                }
+                case 8: { Token::Directive value = { }; valid = readEnum(reader, value, Token::Directive::Pragma); token.value = value; break; }
+                default: return false;
+            }
+
+            u64 length = 0;
+            token.location.source = source;
+            valid = valid && reader.read(token.location.line) && reader.read(token.location.column) && reader.read(length);
+            token.location.length = length;
+
+            return valid;
+        }
+
+    }
+
+    std::fs::path TokenCache::getEntryPath(const api::Source *source) const {
+        return this->m_directory / fmt::format("{:016X}.pltokens", hashContent(source->content));
+    }
+
+    std::optional<TokenCache::Entry> TokenCache::load(const api::Source *source) const {
+        wolv::io::File file(this->getEntryPath(source), wolv::io::File::Mode::Read);
+        if (!file.isValid())
+            return std::nullopt;
+
+        const auto buffer = file.readVector();
+        Reader reader(buffer);
+
+        u32 magic = 0, version = 0;
+        u64 contentSize = 0, contentHash = 0, longestLineLength = 0, tokenCount = 0;
+        if (!reader.read(magic) || !reader.read(version) || !reader.read(contentSize) || !reader.read(contentHash) || !reader.read(longestLineLength) || !reader.read(tokenCount))
+            return std::nullopt;
+
+        // The file name only holds the hash, make sure the entry really belongs to this content
+        if (magic != Magic || version != FormatVersion || contentSize != source->content.size() || contentHash != hashContent(source->content))
+            return std::nullopt;
+
+        Entry entry = { {}, longestLineLength };
+        entry.tokens.reserve(std::min<u64>(tokenCount, buffer.size()));
+        for (u64 i = 0; i < tokenCount; i += 1) {
+            if (!readToken(reader, source, entry.tokens.emplace_back()))
+                return std::nullopt;
+        }
+
+        return entry;
+    }
+
+    void TokenCache::store(const api::Source *source, const Entry &entry) const {
+        Writer writer;
+        writer.write(Magic);
+        writer.write(FormatVersion);
+        writer.write<u64>(source->content.size());
+        writer.write(hashContent(source->content));
+        writer.write<u64>(entry.longestLineLength);
+        writer.write<u64>(entry.tokens.size());
+
+        for (const auto &token : entry.tokens) {
+            if (!writeToken(writer, token))
+                return;
+        }
+
+        std::error_code error;
+        std::fs::create_directories(this->m_directory, error);
+        if (error)
+            return;
+
+        // Write to a temporary file first so other processes sharing the directory never see partial entries
+        const auto entryPath = this->getEntryPath(source);
+        auto temporaryPath = entryPath;
+        temporaryPath += fmt::format(".{:08X}.tmp", std::random_device{}());
+
+        {
+            wolv::io::File file(temporaryPath, wolv::io::File::Mode::Create);
+            if (!file.isValid())
+                return;
+
+            file.writeVector(writer.getBuffer());
+        }
+
+        std::fs::rename(temporaryPath, entryPath, error);
+        if (error)
+            std::fs::remove(temporaryPath, error);
+    }
+
+}
@@ -0,0 +1,130 @@
+#include <pl/core/type_table.hpp>
+
+namespace pl::core {
+
+    namespace {
+
+        // Calls the callback for every segment of a qualified name until it returns false
+        template<typename F>
+        bool forEachSegment(std::string_view name, F &&callback) {
+            while (true) {
+                const auto separator = name.find("::");
+                const auto segment = name.substr(0, separator);
+
+                if (!segment.empty() && !callback(segment))
+                    return false;
+
+                if (separator == std::string_view::npos)
+                    return true;
+
+                name = name.substr(separator + 2);
+            }
+        }
+
+    }
+
+    TypeTable::Scope TypeTable::getScope(Scope parent, std::string_view name) {
+        auto scope = parent;
+        forEachSegment(name, [&](std::string_view segment) {
+            const auto handle = this->m_segments.intern(segment);
+            const auto [it, inserted] = this->m_children.try_emplace(getChildKey(scope, handle), Scope(this->m_scopes.size()));
+            if (inserted)
+                this->m_scopes.push_back({ scope, handle, NoEntry });
+
+            scope = it->second;
+            return true;
+        });
+
+        return scope;
+    }
+
+    TypeTable::Scope TypeTable::findScope(Scope parent, std::string_view name) const {
+        auto scope = parent;
+        const bool found = forEachSegment(name, [&](std::string_view segment) {
+            const auto handle = this->m_segments.find(segment);
+            if (handle == hlp::StringInterner::InvalidHandle)
+                return false;
+
+            const auto it = this->m_children.find(getChildKey(scope, handle));
+            if (it == this->m_children.end())
+                return false;
+
+            scope = it->second;
+            return true;
+        });
+
+        return found ? scope : InvalidScope;
+    }
+
+    std::string TypeTable::getQualifiedName(Scope scope, std::string_view name) const {
+        std::vector<std::string_view> segments;
+        for (; scope != GlobalScope; scope = this->m_scopes[scope].parent)
+            segments.push_back(this->m_segments.get(this->m_scopes[scope].segment));
+
+        std::string result;
+        for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+            result += *it;
+            result += "::";
+        }
+
+        if (name.empty() && !result.empty())
+            result.resize(result.size() - 2);
+        else
+            result += name;
+
+        return result;
+    }
+
+    TypeTable::Type* TypeTable::find(Scope scope, std::string_view name) {
+        const auto found = this->findScope(scope, name);
+        if (found == InvalidScope || this->m_scopes[found].entry == NoEntry)
+            return nullptr;
+
+        return &this->m_entries[this->m_scopes[found].entry].second;
+    }
+
+    TypeTable::Type* TypeTable::resolve(std::span<const Scope> scopeChain, std::string_view name) {
+        if (auto type = this->find(GlobalScope, name); type != nullptr)
+            return type;
+
+        for (const auto scope : scopeChain) {
+            if (auto type = this->find(scope, name); type != nullptr)
+                return type;
+        }
+
+        return nullptr;
+    }
+
+    bool TypeTable::emplace(Scope scope, std::string_view name, Type type) {
+        const auto typeScope = this->getScope(scope, name);
+        if (this->m_scopes[typeScope].entry != NoEntry)
+            return false;
+
+        this->getEntry(typeScope).second = std::move(type);
+        return true;
+    }
+
+    void TypeTable::set(std::string_view qualifiedName, Type type) {
+        this->getEntry(this->getScope(GlobalScope, qualifiedName)).second = std::move(type);
+    }
+
+    void TypeTable::clear() {
+        this->m_segments.clear();
+        this->m_children.clear();
+        this->m_entries.clear();
+
+        this->m_scopes.clear();
+        this->m_scopes.push_back({ GlobalScope, hlp::StringInterner::InvalidHandle, NoEntry });
+    }
+
+    TypeTable::Entry& TypeTable::getEntry(Scope scope) {
+        auto &info = this->m_scopes[scope];
+        if (info.entry == NoEntry) {
+            info.entry = u32(this->m_entries.size());
+            this->m_entries.emplace_back(this->getQualifiedName(scope), Type());
+        }
+
+        return this->m_entries[info.entry];
+    }
+
+}
@@ -0,0 +1,688 @@
+#include <pl/core/vm.hpp>
+
+#include <pl/core/evaluator.hpp>
+#include <pl/patterns/pattern.hpp>
+
+#include <pl/core/ast/ast_node_builtin_type.hpp>
+#include <pl/core/ast/ast_node_compound_statement.hpp>
+#include <pl/core/ast/ast_node_conditional_statement.hpp>
+#include <pl/core/ast/ast_node_control_flow_statement.hpp>
+#include <pl/core/ast/ast_node_function_call.hpp>
+#include <pl/core/ast/ast_node_function_definition.hpp>
+#include <pl/core/ast/ast_node_literal.hpp>
+#include <pl/core/ast/ast_node_lvalue_assignment.hpp>
+#include <pl/core/ast/ast_node_mathematical_expression.hpp>
+#include <pl/core/ast/ast_node_rvalue.hpp>
+#include <pl/core/ast/ast_node_scope_resolution.hpp>
+#include <pl/core/ast/ast_node_ternary_expression.hpp>
+#include <pl/core/ast/ast_node_variable_decl.hpp>
+#include <pl/core/ast/ast_node_while_statement.hpp>
+
+#include <pl/helpers/utils.hpp>
+
+#include <wolv/utils/guards.hpp>
+
+#include <cmath>
+#include <concepts>
+
+namespace pl::core::vm {
+
+    namespace {
+
+        bool isSupportedType(Token::ValueType type) {
+            return Token::isInteger(type) ||
+                   type == Token::ValueType::Float || type == Token::ValueType::Double ||
+                   type == Token::ValueType::Boolean || type == Token::ValueType::Character;
+        }
+
+        std::optional<Token::ValueType> getBuiltinType(const ast::ASTNode *node) {
+            while (auto typeApplication = dynamic_cast<const ast::ASTNodeTypeApplication*>(node)) {
+                if (typeApplication->isReference())
+                    return std::nullopt;
+
+                node = typeApplication->getType().get();
+            }
+
+            if (auto builtinType = dynamic_cast<const ast::ASTNodeBuiltinType*>(node); builtinType != nullptr)
+                return builtinType->getType();
+            else
+                return std::nullopt;
+        }
+
+        Token::Literal getDefaultValue(Token::ValueType type) {
+            if (Token::isUnsigned(type))
+                return u128(0);
+            else if (Token::isSigned(type))
+                return i128(0);
+            else if (Token::isFloatingPoint(type))
+                return double(0);
+            else if (type == Token::ValueType::Boolean)
+                return false;
+            else
+                return char(0);
+        }
+
+        Token::ValueType inferType(const Token::Literal &value) {
+            return std::visit(wolv::util::overloaded {
+                [](u128)        { return Token::ValueType::Unsigned128Bit; },
+                [](i128)        { return Token::ValueType::Signed128Bit; },
+                [](double)      { return Token::ValueType::Double; },
+                [](bool)        { return Token::ValueType::Boolean; },
+                [](char)        { return Token::ValueType::Character; },
+                [](const auto&) { return Token::ValueType::Any; }
+            }, value);
+        }
+
+        // Floating point values outside of the integer range can't be converted directly, saturate them instead
+        template<typename T>
+        i128 toInteger(T value) {
+            if constexpr (std::floating_point<T>) {
+                constexpr i128 maximum = i128(~u128(0) >> 1);
+                constexpr T limit = 0x1p127;
+
+                if (std::isnan(value))
+                    return 0;
+                if (value >= limit)
+                    return maximum;
+                if (value < -limit)
+                    return -maximum - 1;
+            }
+
+            return i128(value);
+        }
+
+        // Same conversion a local variable of the given type applies when it gets written and read back
+        Token::Literal castToType(Token::ValueType type, const Token::Literal &value) {
+            return std::visit(wolv::util::overloaded {
+                [type](const std::string &) -> Token::Literal {
+                    err::E0004.throwError(fmt::format("Cannot assign value of type 'string' to variable of type '{}'.", Token::getTypeName(type)));
+                },
+                [type](const std::shared_ptr<ptrn::Pattern> &pattern) -> Token::Literal {
+                    err::E0004.throwError(fmt::format("Cannot cast from type '{}' to type '{}'.", pattern->getTypeName(), Token::getTypeName(type)));
+                },
+                [type](auto value) -> Token::Literal {
+                    const auto size = Token::getTypeSize(type);
+
+                    if (Token::isUnsigned(type)) {
+                        if (size >= sizeof(u128))
+                            return u128(toInteger(value));
+                        else
+                            return u128(toInteger(value)) & ((u128(1) << (size * 8)) - 1);
+                    } else if (Token::isSigned(type)) {
+                        return hlp::signExtend(size * 8, toInteger(value));
+                    } else if (type == Token::ValueType::Float) {
+                        return double(float(value));
+                    } else if (type == Token::ValueType::Double) {
+                        return double(value);
+                    } else if (type == Token::ValueType::Boolean) {
+                        return value != 0;
+                    } else {
+                        return char(u128(toInteger(value)) & 0xFF);
+                    }
+                }
+            }, value);
+        }
+
+        bool isTrue(const Token::Literal &value) {
+            return std::visit(wolv::util::overloaded {
+                [](const std::string &string) -> bool { return !string.empty(); },
+                [](const std::shared_ptr<ptrn::Pattern> &pattern) -> bool { return pattern != nullptr; },
+                [](auto &&value) -> bool { return value != 0; }
+            }, value);
+        }
+
+        class Compiler {
+        public:
+            std::unique_ptr<Program> compile(const ast::ASTNodeFunctionDefinition *function) {
+                if (function->getParameterPack().has_value())
+                    return nullptr;
+
+                this->m_program = std::make_unique<Program>();
+                this->m_scopes.emplace_back();
+
+                for (const auto &[name, type] : function->getParams()) {
+                    auto typeApplication = dynamic_cast<const ast::ASTNodeTypeApplication*>(type.get());
+                    if (typeApplication == nullptr)
+                        return nullptr;
+
+                    auto builtinType = getBuiltinType(typeApplication);
+                    if (!builtinType.has_value())
+                        return nullptr;
+
+                    if (*builtinType == Token::ValueType::Auto)
+                        builtinType = Token::ValueType::Any;
+                    else if (!isSupportedType(*builtinType))
+                        return nullptr;
+
+                    if (!this->declareVariable(name, *builtinType).has_value())
+                        return nullptr;
+                }
+
+                this->m_program->parameterCount = this->m_program->registerTypes.size();
+
+                for (const auto &statement : function->getBody()) {
+                    if (!this->compileStatement(statement.get()))
+                        return nullptr;
+                }
+
+                this->emit(Opcode::ReturnVoid);
+
+                return std::move(this->m_program);
+            }
+
+        private:
+            struct Loop {
+                std::vector<u32> breakJumps, continueJumps;
+            };
+
+            u32 emit(Opcode opcode, u32 dst = 0, u32 a = 0, u32 b = 0, const ast::ASTNode *node = nullptr) {
+                this->m_program->instructions.push_back({ opcode, dst, a, b, node });
+
+                return this->m_program->instructions.size() - 1;
+            }
+
+            [[nodiscard]] u32 getNextAddress() const {
+                return this->m_program->instructions.size();
+            }
+
+            void patchJump(u32 instruction, u32 target) {
+                this->m_program->instructions[instruction].b = target;
+            }
+
+            u32 allocateRegister(Token::ValueType type = Token::ValueType::Any) {
+                this->m_program->registerTypes.push_back(type);
+
+                return this->m_program->registerTypes.size() - 1;
+            }
+
+            std::optional<u32> declareVariable(const std::string &name, Token::ValueType type) {
+                // Redeclaring a variable that's visible in the current scope is an error the AST interpreter reports
+                if (name == "_" || this->findVariable(name).has_value())
+                    return std::nullopt;
+
+                auto reg = this->allocateRegister(type);
+                this->m_scopes.back().emplace_back(name, reg);
+
+                return reg;
+            }
+
+            [[nodiscard]] std::optional<u32> findVariable(const std::string &name) const {
+                for (auto scope = this->m_scopes.rbegin(); scope != this->m_scopes.rend(); ++scope) {
+                    for (const auto &[variableName, reg] : *scope) {
+                        if (variableName == name)
+                            return reg;
+                    }
+                }
+
+                return std::nullopt;
+            }
+
+            u32 addConstant(const Token::Literal &value) {
+                this->m_program->constants.push_back(value);
+
+                return this->m_program->constants.size() - 1;
+            }
+
+            bool compileBody(const auto &statements) {
+                this->m_scopes.emplace_back();
+                ON_SCOPE_EXIT { this->m_scopes.pop_back(); };
+
+                for (const auto &statement : statements) {
+                    if (!this->compileStatement(statement.get()))
+                        return false;
+                }
+
+                return true;
+            }
+
+            // Checks if a node can be evaluated by the AST interpreter because it doesn't read any register
+            [[nodiscard]] bool referencesRegisters(const ast::ASTNode *node) const {
+                if (node == nullptr || dynamic_cast<const ast::ASTNodeLiteral*>(node) != nullptr || dynamic_cast<const ast::ASTNodeScopeResolution*>(node) != nullptr)
+                    return false;
+
+                if (auto rvalue = dynamic_cast<const ast::ASTNodeRValue*>(node); rvalue != nullptr) {
+                    for (const auto &segment : rvalue->getPath()) {
+                        if (auto name = std::get_if<std::string>(&segment); name != nullptr) {
+                            if (&segment == &rvalue->getPath().front() && this->findVariable(*name).has_value())
+                                return true;
+                        } else if (this->referencesRegisters(std::get<std::unique_ptr<ast::ASTNode>>(segment).get())) {
+                            return true;
+                        }
+                    }
+
+                    return false;
+                }
+
+                if (auto expression = dynamic_cast<const ast::ASTNodeMathematicalExpression*>(node); expression != nullptr)
+                    return this->referencesRegisters(expression->getLeftOperand().get()) || this->referencesRegisters(expression->getRightOperand().get());
+
+                return true;
+            }
+
+            bool compileExpression(const ast::ASTNode *node, u32 dst) {
+                if (auto literal = dynamic_cast<const ast::ASTNodeLiteral*>(node); literal != nullptr) {
+                    this->emit(Opcode::LoadConstant, dst, this->addConstant(literal->getValue()));
+                    return true;
+                }
+
+                if (auto rvalue = dynamic_cast<const ast::ASTNodeRValue*>(node); rvalue != nullptr) {
+                    if (rvalue->getPath().size() == 1) {
+                        if (auto name = std::get_if<std::string>(&rvalue->getPath().front()); name != nullptr) {
+                            if (auto reg = this->findVariable(*name); reg.has_value()) {
+                                this->emit(Opcode::Move, dst, *reg);
+                                return true;
+                            }
+                        }
+                    }
+                }
+
+                if (auto expression = dynamic_cast<const ast::ASTNodeMathematicalExpression*>(node); expression != nullptr) {
+                    if (expression->getLeftOperand() == nullptr || expression->getRightOperand() == nullptr)
+                        return false;
+
+                    auto left = this->allocateRegister();
+                    auto right = this->allocateRegister();
+                    if (!this->compileExpression(expression->getLeftOperand().get(), left))
+                        return false;
+
+                    std::optional<u32> shortCircuit;
+                    if (expression->getOperator() == Token::Operator::BoolAnd || expression->getOperator() == Token::Operator::BoolOr)
+                        shortCircuit = this->emit(Opcode::ShortCircuit, dst, left, 0, expression);
+
+                    if (!this->compileExpression(expression->getRightOperand().get(), right))
+                        return false;
+
+                    this->emit(Opcode::Binary, dst, left, right, expression);
+
+                    if (shortCircuit.has_value())
+                        this->patchJump(*shortCircuit, this->getNextAddress());
+
+                    return true;
+                }
+
+                if (auto ternary = dynamic_cast<const ast::ASTNodeTernaryExpression*>(node); ternary != nullptr) {
+                    if (ternary->getFirstOperand() == nullptr || ternary->getSecondOperand() == nullptr || ternary->getThirdOperand() == nullptr)
+                        return false;
+
+                    auto condition = this->allocateRegister();
+                    if (!this->compileExpression(ternary->getFirstOperand().get(), condition))
+                        return false;
+
+                    auto falseJump = this->emit(Opcode::TernaryJumpIfFalse, 0, condition, 0, ternary);
+                    if (!this->compileExpression(ternary->getSecondOperand().get(), dst))
+                        return false;
+
+                    auto endJump = this->emit(Opcode::Jump);
+                    this->patchJump(falseJump, this->getNextAddress());
+                    if (!this->compileExpression(ternary->getThirdOperand().get(), dst))
+                        return false;
+
+                    this->patchJump(endJump, this->getNextAddress());
+
+                    return true;
+                }
+
+                if (auto functionCall = dynamic_cast<const ast::ASTNodeFunctionCall*>(node); functionCall != nullptr) {
+                    const auto &params = functionCall->getParams();
+
+                    auto first = u32(this->m_program->registerTypes.size());
+                    for (size_t i = 0; i < params.size(); i++)
+                        this->allocateRegister();
+
+                    for (size_t i = 0; i < params.size(); i++) {
+                        if (!this->compileExpression(params[i].get(), first + i))
+                            return false;
+                    }
+
+                    this->emit(Opcode::Call, dst, first, params.size(), functionCall);
+
+                    return true;
+                }
+
+                if (!this->referencesRegisters(node)) {
+                    this->emit(Opcode::Evaluate, dst, 0, 0, node);
+                    return true;
+                }
+
+                return false;
+            }
+
+            bool compileStatement(const ast::ASTNode *node) {
+                if (auto compoundStatement = dynamic_cast<const ast::ASTNodeCompoundStatement*>(node); compoundStatement != nullptr) {
+                    if (compoundStatement->m_newScope)
+                        return this->compileBody(compoundStatement->getStatements());
+
+                    for (const auto &statement : compoundStatement->getStatements()) {
+                        if (!this->compileStatement(statement.get()))
+                            return false;
+                    }
+
+                    return true;
+                }
+
+                if (auto variableDecl = dynamic_cast<const ast::ASTNodeVariableDecl*>(node); variableDecl != nullptr) {
+                    if (variableDecl->getPlacementOffset() != nullptr || variableDecl->isInVariable() || variableDecl->isOutVariable() || variableDecl->isConstant() || !variableDecl->getAttributes().empty())
+                        return false;
+
+                    auto type = getBuiltinType(variableDecl->getType().get());
+                    if (!type.has_value() || !isSupportedType(*type))
+                        return false;
+
+                    auto reg = this->declareVariable(variableDecl->getName(), *type);
+                    if (!reg.has_value())
+                        return false;
+
+                    this->emit(Opcode::LoadConstant, *reg, this->addConstant(getDefaultValue(*type)));
+
+                    return true;
+                }
+
+                if (auto assignment = dynamic_cast<const ast::ASTNodeLValueAssignment*>(node); assignment != nullptr) {
+                    if (!assignment->getAttributes().empty())
+                        return false;
+
+                    auto reg = this->findVariable(assignment->getLValueName());
+                    if (!reg.has_value())
+                        return false;
+
+                    auto value = this->allocateRegister();
+                    if (!this->compileExpression(assignment->getRValue().get(), value))
+                        return false;
+
+                    this->emit(Opcode::Store, *reg, value, 0, assignment);
+
+                    return true;
+                }
+
+                if (auto controlFlow = dynamic_cast<const ast::ASTNodeControlFlowStatement*>(node); controlFlow != nullptr) {
+                    switch (controlFlow->getType()) {
+                        case ControlFlowStatement::Return:
+                            if (controlFlow->getReturnValue() == nullptr) {
+                                this->emit(Opcode::ReturnVoid);
+                            } else {
+                                auto value = this->allocateRegister();
+                                if (!this->compileExpression(controlFlow->getReturnValue().get(), value))
+                                    return false;
+
+                                this->emit(Opcode::Return, 0, value);
+                            }
+                            return true;
+                        case ControlFlowStatement::Break:
+                            if (this->m_loops.empty())
+                                return false;
+
+                            this->m_loops.back().breakJumps.push_back(this->emit(Opcode::Jump));
+                            return true;
+                        case ControlFlowStatement::Continue:
+                            if (this->m_loops.empty())
+                                return false;
+
+                            this->m_loops.back().continueJumps.push_back(this->emit(Opcode::Jump));
+                            return true;
+                        default:
+                            return false;
+                    }
+                }
+
+                if (auto conditional = dynamic_cast<const ast::ASTNodeConditionalStatement*>(node); conditional != nullptr) {
+                    auto condition = this->allocateRegister();
+                    if (!this->compileExpression(conditional->getCondition().get(), condition))
+                        return false;
+
+                    auto falseJump = this->emit(Opcode::JumpIfFalse, 0, condition, 0, conditional);
+                    if (!this->compileBody(conditional->getTrueBody()))
+                        return false;
+
+                    auto endJump = this->emit(Opcode::Jump);
+                    this->patchJump(falseJump, this->getNextAddress());
+                    if (!this->compileBody(conditional->getFalseBody()))
+                        return false;
+
+                    this->patchJump(endJump, this->getNextAddress());
+
+                    return true;
+                }
+
+                if (auto whileStatement = dynamic_cast<const ast::ASTNodeWhileStatement*>(node); whileStatement != nullptr) {
+                    auto counter = this->allocateRegister();
+                    auto condition = this->allocateRegister();
+
+                    this->emit(Opcode::LoopStart, counter);
+
+                    auto loopStart = this->getNextAddress();
+                    if (!this->compileExpression(whileStatement->getCondition().get(), condition))
+                        return false;
+
+                    auto exitJump = this->emit(Opcode::JumpIfFalse, 0, condition, 0, whileStatement);
+
+                    // The post expression of for loops runs in the scope of the loop body, even after a break
+                    this->m_scopes.emplace_back();
+                    ON_SCOPE_EXIT { this->m_scopes.pop_back(); };
+
+                    this->m_loops.emplace_back();
+                    for (const auto &statement : whileStatement->getBody()) {
+                        if (!this->compileStatement(statement.get()))
+                            return false;
+                    }
+                    auto loop = std::move(this->m_loops.back());
+                    this->m_loops.pop_back();
+
+                    for (auto jump : loop.continueJumps)
+                        this->patchJump(jump, this->getNextAddress());
+
+                    if (whileStatement->getPostExpression() != nullptr && !this->compileStatement(whileStatement->getPostExpression().get()))
+                        return false;
+
+                    this->emit(Opcode::LoopIteration, counter, 0, 0, whileStatement);
+                    this->emit(Opcode::Jump, 0, 0, loopStart);
+
+                    if (!loop.breakJumps.empty()) {
+                        for (auto jump : loop.breakJumps)
+                            this->patchJump(jump, this->getNextAddress());
+
+                        if (whileStatement->getPostExpression() != nullptr && !this->compileStatement(whileStatement->getPostExpression().get()))
+                            return false;
+
+                        this->emit(Opcode::LoopIteration, counter, 0, 0, whileStatement);
+                    }
+
+                    this->patchJump(exitJump, this->getNextAddress());
+
+                    return true;
+                }
+
+                if (auto functionCall = dynamic_cast<const ast::ASTNodeFunctionCall*>(node); functionCall != nullptr)
+                    return this->compileExpression(functionCall, this->allocateRegister());
+
+                return false;
+            }
+
+        private:
+            std::unique_ptr<Program> m_program;
+            std::vector<std::vector<std::pair<std::string, u32>>> m_scopes;
+            std::vector<Loop> m_loops;
+        };
+
+    }
+
+    std::unique_ptr<Program> compile(const ast::ASTNodeFunctionDefinition *function) {
+        return Compiler().compile(function);
+    }
+
+    bool VirtualMachine::canExecute(const Program &program, std::span<const Token::Literal> params) {
+        if (params.size() != program.parameterCount)
+            return false;
+
+        return std::ranges::all_of(params, [](const Token::Literal &param) {
+            return !param.isString() && !param.isPattern();
+        });
+    }
+
+    std::optional<Token::Literal> VirtualMachine::execute(Evaluator *evaluator, const Program &program, std::span<const Token::Literal> params) {
+        std::vector<std::shared_ptr<ptrn::Pattern>> variables;
+
+        this->m_executedProgramCount += 1;
+
+        auto startOffset = evaluator->getBitwiseReadOffset();
+        evaluator->pushScope(nullptr, variables, true);
+        evaluator->pushSectionId(ptrn::Pattern::HeapSectionId);
+        ON_SCOPE_EXIT {
+            evaluator->popScope();
+            evaluator->setBitwiseReadOffset(startOffset);
+            evaluator->popSectionId();
+        };
+
+        // Registers of nested calls are placed above the ones of the current call
+        const auto base = this->m_registers.size();
+        this->m_registers.resize(base + program.registerTypes.size());
+        this->m_registerTypes.insert(this->m_registerTypes.end(), program.registerTypes.begin(), program.registerTypes.end());
+        ON_SCOPE_EXIT {
+            this->m_registers.resize(base);
+            this->m_registerTypes.resize(base);
+        };
+
+        const auto registers = [this, base](u32 index) -> std::optional<Token::Literal>& {
+            return this->m_registers[base + index];
+        };
+
+        for (u32 i = 0; i < program.parameterCount; i++) {
+            auto &type = this->m_registerTypes[base + i];
+            if (type == Token::ValueType::Any)
+                type = inferType(params[i]);
+
+            registers(i) = castToType(type, params[i]);
+        }
+
+        const auto &instructions = program.instructions;
+        for (u32 pc = 0; pc < instructions.size();) {
+            const auto &instruction = instructions[pc];
+            pc += 1;
+
+            switch (instruction.opcode) {
+                case Opcode::LoadConstant:
+                    registers(instruction.dst) = program.constants[instruction.a];
+                    break;
+                case Opcode::Move:
+                    registers(instruction.dst) = registers(instruction.a);
+                    break;
+                case Opcode::Store: {
+                    [[maybe_unused]] auto context = evaluator->updateRuntime(instruction.node);
+
+                    auto &value = registers(instruction.a);
+                    if (!value.has_value())
+                        err::E0010.throwError("Cannot assign void expression to variable.", {}, instruction.node->getLocation());
+
+                    if (value->isPattern()) {
+                        auto decayedValue = value->toPattern()->getValue();
+                        if (!decayedValue.isPattern())
+                            value = std::move(decayedValue);
+                    }
+
+                    registers(instruction.dst) = castToType(this->m_registerTypes[base + instruction.dst], *value);
+                    break;
+                }
+                case Opcode::Evaluate: {
+                    registers(instruction.dst) = instruction.node->evaluateValue(evaluator);
+                    break;
+                }
+                case Opcode::Binary: {
+                    [[maybe_unused]] auto context = evaluator->updateRuntime(instruction.node);
+
+                    auto expression = static_cast<const ast::ASTNodeMathematicalExpression*>(instruction.node);
+                    const auto &left = registers(instruction.a);
+                    const auto &right = registers(instruction.b);
+                    if (!left.has_value() || !right.has_value())
+                        err::E0002.throwError("Invalid operand used in mathematical expression.", { }, expression->getLocation());
+
+                    registers(instruction.dst) = expression->evaluateOperator(evaluator, *left, *right);
+                    break;
+                }
+                case Opcode::ShortCircuit: {
+                    auto expression = static_cast<const ast::ASTNodeMathematicalExpression*>(instruction.node);
+                    const auto &left = registers(instruction.a);
+                    if (!left.has_value())
+                        err::E0002.throwError("Invalid operand used in mathematical expression.", { }, expression->getLocation());
+
+                    auto value = isTrue(*left);
+                    if ((expression->getOperator() == Token::Operator::BoolAnd && !value) || (expression->getOperator() == Token::Operator::BoolOr && value)) {
+                        registers(instruction.dst) = value;
+                        pc = instruction.b;
+                    }
+                    break;
+                }
+                case Opcode::JumpIfFalse: {
+                    [[maybe_unused]] auto context = evaluator->updateRuntime(instruction.node);
+
+                    const auto &condition = registers(instruction.a);
+                    if (!condition.has_value())
+                        err::E0010.throwError("Cannot use void expression as condition.", {}, instruction.node->getLocation());
+
+                    if (!isTrue(*condition))
+                        pc = instruction.b;
+                    break;
+                }
+                case Opcode::TernaryJumpIfFalse: {
+                    const auto &condition = registers(instruction.a);
+                    if (!condition.has_value())
+                        err::E0010.throwError("Cannot use void expression in ternary expression.", {}, instruction.node->getLocation());
+                    if (condition->isPattern())
+                        err::E0002.throwError(fmt::format("Cannot cast {} to bool.", condition->toPattern()->getTypeName()), {}, instruction.node->getLocation());
+
+                    if (!isTrue(*condition))
+                        pc = instruction.b;
+                    break;
+                }
+                case Opcode::Jump:
+                    pc = instruction.b;
+                    break;
+                case Opcode::Call: {
+                    [[maybe_unused]] auto context = evaluator->updateRuntime(instruction.node);
+
+                    auto &arguments = evaluator->pushArgumentFrame();
+                    ON_SCOPE_EXIT { evaluator->popArgumentFrame(); };
+
+                    for (u32 i = 0; i < instruction.b; i++) {
+                        auto &argument = registers(instruction.a + i);
+                        if (!argument.has_value())
+                            err::E0002.throwError("Cannot evaluate void expression", "Did you try to work with the result of a function that didn't return anything?", instruction.node->getLocation());
+
+                        arguments.push_back(std::move(*argument));
+                    }
+
+                    auto result = static_cast<const ast::ASTNodeFunctionCall*>(instruction.node)->callFunction(evaluator, arguments);
+                    registers(instruction.dst) = std::move(result);
+                    break;
+                }
+                case Opcode::LoopStart:
+                    registers(instruction.dst) = u128(0);
+                    break;
+                case Opcode::LoopIteration: {
+                    auto &counter = std::get<u128>(*registers(instruction.dst));
+                    counter += 1;
+                    if (counter >= evaluator->getLoopLimit())
+                        err::E0007.throwError(fmt::format("Loop iterations exceeded set limit of {}", evaluator->getLoopLimit()), "If this is intended, try increasing the limit using '#pragma loop_limit <new_limit>'.");
+
+                    evaluator->handleAbort();
+                    break;
+                }
+                case Opcode::Return: {
+                    auto result = std::move(registers(instruction.a));
+
+                    if (result.has_value() && result->isPattern()) {
+                        auto &prevScope = evaluator->getScope(-1);
+                        auto &currScope = evaluator->getScope(0);
+
+                        prevScope.heapStartSize = currScope.heapStartSize = evaluator->getHeap().size();
+                    }
+
+                    return result;
+                }
+                case Opcode::ReturnVoid:
+                    return std::nullopt;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+}
@@ -30,7 +30,7 @@ namespace pl::lib::libstd::core {
                 auto pattern = params[0].toPattern();
                 auto attributeName = params[1].toString(false);
 
-                auto &attributes = pattern->getAttributes();
+                const auto attributes = pattern->getAttributes();
                 if (attributes == nullptr)
                     return false;
                 else
@@ -43,7 +43,7 @@ namespace pl::lib::libstd::core {
                 auto attributeName = params[1].toString(false);
                 auto index = size_t(params[2].toUnsigned());
 
-                auto &attributes = pattern->getAttributes();
+                const auto attributes = pattern->getAttributes();
                 if (attributes == nullptr || !attributes->contains(attributeName))
                     return std::string();
                 else {
@@ -134,7 +134,7 @@ namespace pl::lib::libstd::core {
                 auto hasMember = [&](const auto &members) {
                     return std::any_of(members.begin(), members.end(),
                         [&](const std::shared_ptr<ptrn::Pattern> &member) {
-                            return member->getVariableName() == name;
+                            return member->hasVariableName(name);
                         });
                 };
 
@@ -178,11 +178,7 @@ namespace pl::lib::libstd::core {
                     err::E0009.throwError(fmt::format("Function '{}' does not exist.", functionName), {});
                 }
 
-                std::vector<pl::core::Token::Literal> functionParams;
-                for (size_t i = 1; i < params.size(); i += 1)
-                    functionParams.emplace_back(std::move(params[i]));
-
-                return function.value().func(evaluator, functionParams);
+                return function.value().func(evaluator, params.subspan(1));
             });
 
             /* insert_pattern(pattern) */
@@ -196,7 +192,7 @@ namespace pl::lib::libstd::core {
                     // Check for duplicates
                     for (auto &a : entries) {
                         for (auto &b : currScope) {
-                            if (a->getVariableName() == b->getVariableName()) [[unlikely]] {
+                            if (a->hasSameVariableName(*b)) [[unlikely]] {
                                 err::E0012.throwError(fmt::format("Error inserting patterns into current scope. Pattern with name '{}' already exists.", a->getVariableName()));
                             }
                         }
@@ -38,6 +38,17 @@ namespace pl::lib::libstd {
                 return false;
         });
 
+        runtime.addPragma("engine", [](pl::PatternLanguage &runtime, const std::string &value) {
+            if (value == "ast") {
+                runtime.getInternals().evaluator->setExecutionEngine(core::ExecutionEngine::AST);
+                return true;
+            } else if (value == "bytecode") {
+                runtime.getInternals().evaluator->setExecutionEngine(core::ExecutionEngine::Bytecode);
+                return true;
+            } else
+                return false;
+        });
+
         runtime.addPragma("eval_depth", [](pl::PatternLanguage &runtime, const std::string &value) {
             auto limit = parseLimit(value);
             if (!limit.has_value())
@@ -92,6 +103,15 @@ namespace pl::lib::libstd {
             return true;
         });
 
+        runtime.addPragma("lazy_pointers", [](pl::PatternLanguage &runtime, const std::string &value) {
+            if (!value.empty())
+                return false;
+
+            runtime.getInternals().evaluator->setLazyPointers(true);
+
+            return true;
+        });
+
         runtime.addPragma("allow_edits", [](pl::PatternLanguage &runtime, const std::string &value) {
             if (!value.empty())
                 return false;
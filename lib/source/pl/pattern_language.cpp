@@ -11,6 +11,7 @@
 
 #include <pl/patterns/pattern.hpp>
 #include <pl/patterns/pattern_array_static.hpp>
+#include <pl/patterns/pattern_array_lazy.hpp>
 
 #include <pl/lib/std/libstd.hpp>
 
@@ -18,6 +19,8 @@
 #include <wolv/io/file.hpp>
 #include <wolv/utils/string.hpp>
 
+#include <ranges>
+
 namespace pl {
 
     static std::string getFunctionName(const api::Namespace &ns, const std::string &name) {
@@ -32,6 +35,12 @@ namespace pl {
         return functionName;
     }
 
+    static api::FunctionSpanCallback adaptFunctionCallback(const api::FunctionCallback &func) {
+        return [func](core::Evaluator *evaluator, std::span<const core::Token::Literal> params) -> std::optional<core::Token::Literal> {
+            return func(evaluator, { params.begin(), params.end() });
+        };
+    }
+
     PatternLanguage::PatternLanguage(const bool addLibStd) {
         this->m_internals = {
             .preprocessor   = std::make_unique<core::Preprocessor>(),
@@ -83,6 +92,8 @@ namespace pl {
         this->m_flattenedPatterns   = std::move(other.m_flattenedPatterns);
         this->m_cleanupCallbacks    = std::move(other.m_cleanupCallbacks);
         this->m_currAST             = std::move(other.m_currAST);
+        this->m_compiledProgram     = std::move(other.m_compiledProgram);
+        this->m_resolvedSources     = std::move(other.m_resolvedSources);
 
         this->m_dataBaseAddress     = other.m_dataBaseAddress;
         this->m_dataSize            = other.m_dataSize;
@@ -102,6 +113,12 @@ namespace pl {
 
         m_startAddress  = std::move(other.m_startAddress);
         m_defaultEndian = other.m_defaultEndian;
+        m_executionEngine = other.m_executionEngine;
+        m_evaluationMode = other.m_evaluationMode;
+        m_workerCount = other.m_workerCount;
+        m_patternArenaEnabled = other.m_patternArenaEnabled;
+        m_compileCacheEnabled = other.m_compileCacheEnabled;
+        m_tokenCachePath = std::move(other.m_tokenCachePath);
         m_runningTime   = other.m_runningTime;
     }
 
@@ -116,6 +133,12 @@ namespace pl {
 
         runtime.m_startAddress  = this->m_startAddress;
         runtime.m_defaultEndian = this->m_defaultEndian;
+        runtime.m_executionEngine = this->m_executionEngine;
+        runtime.m_evaluationMode = this->m_evaluationMode;
+        runtime.m_workerCount = this->m_workerCount;
+        runtime.m_patternArenaEnabled = this->m_patternArenaEnabled;
+        runtime.m_compileCacheEnabled = this->m_compileCacheEnabled;
+        runtime.m_tokenCachePath = this->m_tokenCachePath;
 
         runtime.m_dataBaseAddress     = this->m_dataBaseAddress;
         runtime.m_dataSize            = this->m_dataSize;
@@ -154,6 +177,9 @@ namespace pl {
     }
 
     std::optional<std::vector<std::shared_ptr<core::ast::ASTNode>>> PatternLanguage::parseString(const std::string &code, const std::string &source) {
+        if (auto ast = this->loadCompiledProgram(code, source); ast.has_value())
+            return ast;
+
         auto tokens = this->preprocessString(code, source);
         if (!tokens.has_value() || tokens->empty())
             return std::nullopt;
@@ -187,9 +213,68 @@ namespace pl {
         if (ast->empty() || !ast.has_value())
             return std::nullopt;
         this->m_currAST = std::move(*ast);
+        this->storeCompiledProgram(code, source);
+
         return m_currAST;
     }
 
+    std::optional<std::vector<std::shared_ptr<core::ast::ASTNode>>> PatternLanguage::loadCompiledProgram(const std::string &code, const std::string &source) {
+        if (!this->m_compileCacheEnabled || !this->m_compiledProgram.has_value())
+            return std::nullopt;
+
+        const auto &program = *this->m_compiledProgram;
+        if (program.code != code || program.source != source || program.defines != this->m_defines || program.includePaths != this->m_fileResolver.getIncludePaths())
+            return std::nullopt;
+        if (!std::ranges::equal(program.pragmaHandlers, this->m_pragmas | std::views::keys))
+            return std::nullopt;
+
+        // Included files might have been changed since the program was compiled
+        for (const auto &[path, contentHash] : program.resolvedSources) {
+            auto result = this->m_resolvers.resolve(path);
+            if (!result.isOk() || std::hash<std::string_view>{}(result.unwrap()->content) != contentHash)
+                return std::nullopt;
+        }
+
+        // The front end state still belongs to the cached program, only the evaluation state needs to be reset
+        this->resetEvaluation();
+        wolv::util::unused(this->addVirtualSource(code, source, true));
+
+        // Pragmas configure the runtime, so they need to be applied again for every run
+        for (const auto &[name, value] : program.pragmas) {
+            if (auto it = this->m_pragmas.find(name); it != this->m_pragmas.end())
+                it->second(*this, value);
+        }
+
+        this->m_currAST = program.ast;
+        return this->m_currAST;
+    }
+
+    void PatternLanguage::storeCompiledProgram(const std::string &code, const std::string &source) {
+        if (!this->m_compileCacheEnabled || !this->m_compileErrors.empty())
+            return;
+
+        CompiledProgram program = {
+            .code               = code,
+            .source             = source,
+            .defines            = this->m_defines,
+            .includePaths       = this->m_fileResolver.getIncludePaths(),
+            .pragmaHandlers     = { },
+            .resolvedSources    = this->m_resolvedSources,
+            .pragmas            = { },
+            .ast                = this->m_currAST
+        };
+
+        for (const auto &name : this->m_pragmas | std::views::keys)
+            program.pragmaHandlers.push_back(name);
+
+        for (const auto &[name, values] : this->m_internals.preprocessor->getPragmas()) {
+            for (const auto &[value, line] : values)
+                program.pragmas.emplace_back(name, value);
+        }
+
+        this->m_compiledProgram = std::move(program);
+    }
+
     int PatternLanguage::executeString(const std::string& code, const std::string& source, const std::map<std::string, core::Token::Literal> &envVars, const std::map<std::string, core::Token::Literal> &inVariables, bool checkResult) {
 	   	const auto startTime = std::chrono::high_resolution_clock::now();
         ON_SCOPE_EXIT {
@@ -268,11 +353,10 @@ namespace pl {
             const auto &callStack = evaluator->getCallStack();
             u32 lastLine = 0;
             for (const auto &entry : callStack) {
-                const auto &[node, address] = entry;
+                const auto &[location, node, address] = entry;
                 if (node == nullptr)
                     continue;
 
-                const auto &location = node->getLocation();
                 if (lastLine == location.line)
                     continue;
 
@@ -304,7 +388,7 @@ namespace pl {
             this->m_patterns[pattern->getSection()].push_back(pattern);
 
         for (const auto &pattern : this->m_patterns[ptrn::Pattern::HeapSectionId]) {
-            if (pattern->hasAttribute("export")) {
+            if (pattern->hasAttribute(core::attr::Export)) {
                 this->m_patterns[ptrn::Pattern::MainSectionId].emplace_back(pattern);
             }
         }
@@ -435,6 +519,32 @@ namespace pl {
         this->m_defaultEndian = endian;
     }
 
+    void PatternLanguage::setExecutionEngine(core::ExecutionEngine engine) {
+        this->m_executionEngine = engine;
+    }
+
+    void PatternLanguage::setEvaluationMode(core::EvaluationMode mode) {
+        this->m_evaluationMode = mode;
+    }
+
+    void PatternLanguage::setWorkerCount(u32 count) {
+        this->m_workerCount = count;
+    }
+
+    void PatternLanguage::setPatternArenaEnabled(bool enabled) {
+        this->m_patternArenaEnabled = enabled;
+    }
+
+    void PatternLanguage::setCompileCacheEnabled(bool enabled) {
+        this->m_compileCacheEnabled = enabled;
+        if (!enabled)
+            this->m_compiledProgram.reset();
+    }
+
+    void PatternLanguage::setTokenCachePath(const std::fs::path &path) {
+        this->m_tokenCachePath = path;
+    }
+
     void PatternLanguage::setStartAddress(u64 address) {
         this->m_startAddress = address;
     }
@@ -496,36 +606,34 @@ namespace pl {
 
 
     void PatternLanguage::reset() {
-        if (this->m_flattenThread.joinable())
-            this->m_flattenThread.join();
-        this->m_patterns.clear();
-        this->m_flattenedPatterns.clear();
-        this->m_flattenedPatternsValid = false;
+        this->resetEvaluation();
+
+        // Resetting the parser invalidates the types used by a cached program
+        this->m_compiledProgram.reset();
+        this->m_resolvedSources.clear();
 
-        this->m_currError.reset();
-        this->m_compileErrors.clear();
         this->m_parserManager.reset();
         this->m_internals.validator->setRecursionDepth(32);
 
         this->m_internals.preprocessor->reset();
         this->m_internals.lexer->reset();
+        if (this->m_tokenCachePath.empty())
+            this->m_internals.lexer->setTokenCache(std::nullopt);
+        else
+            this->m_internals.lexer->setTokenCache(core::TokenCache(this->m_tokenCachePath));
         this->m_internals.parser->reset();
-        this->m_internals.evaluator->getConsole().clear();
-        this->m_internals.evaluator->setDefaultEndian(this->m_defaultEndian);
-        this->m_internals.evaluator->setEvaluationDepth(32);
-        this->m_internals.evaluator->setArrayLimit(0x10000);
-        this->m_internals.evaluator->setPatternLimit(0x100000);
-        this->m_internals.evaluator->setLoopLimit(0x1000);
-        this->m_internals.evaluator->setDebugMode(false);
         this->m_internals.parser->setParserManager(&m_parserManager);
-        this->m_patternsValid = false;
 
         this->m_resolvers.setDefaultResolver([this](const std::string& path) {
             return this->m_fileResolver.resolve(path);
         });
 
         auto resolver = [this](const std::string& path) {
-            return this->m_resolvers.resolve(path);
+            auto result = this->m_resolvers.resolve(path);
+            if (result.isOk())
+                this->m_resolvedSources[path] = std::hash<std::string_view>{}(result.unwrap()->content);
+
+            return result;
         };
 
         this->m_internals.preprocessor->setResolver(resolver);
@@ -533,15 +641,43 @@ namespace pl {
         this->m_parserManager.setPatternLanguage(this);
     }
 
+    void PatternLanguage::resetEvaluation() {
+        if (this->m_flattenThread.joinable())
+            this->m_flattenThread.join();
+        this->m_internals.evaluator->releasePatterns([this] {
+            this->m_patterns.clear();
+            this->m_flattenedPatterns.clear();
+        });
+        this->m_flattenedPatternsValid = false;
+
+        this->m_currError.reset();
+        this->m_compileErrors.clear();
+
+        this->m_internals.evaluator->getConsole().clear();
+        this->m_internals.evaluator->setDefaultEndian(this->m_defaultEndian);
+        this->m_internals.evaluator->setExecutionEngine(this->m_executionEngine);
+        this->m_internals.evaluator->setEvaluationMode(this->m_evaluationMode);
+        this->m_internals.evaluator->setWorkerCount(this->m_workerCount);
+        this->m_internals.evaluator->setPatternArenaEnabled(this->m_patternArenaEnabled);
+        this->m_internals.evaluator->setEvaluationDepth(32);
+        this->m_internals.evaluator->setArrayLimit(0x10000);
+        this->m_internals.evaluator->setPatternLimit(0x100000);
+        this->m_internals.evaluator->setLoopLimit(0x1000);
+        this->m_internals.evaluator->setDebugMode(false);
+        this->m_internals.evaluator->setLazyPointers(false);
+        this->m_patternsValid = false;
+    }
+
     void PatternLanguage::addFunction(const api::Namespace &ns, const std::string &name, api::FunctionParameterCount parameterCount, const api::FunctionCallback &func) {
-        this->m_functions.emplace_back(ns, name, parameterCount, func, false);
+        this->m_functions.emplace_back(ns, name, parameterCount, adaptFunctionCallback(func), false);
     }
 
     void PatternLanguage::addDangerousFunction(const api::Namespace &ns, const std::string &name, api::FunctionParameterCount parameterCount, const api::FunctionCallback &func) {
-        this->m_functions.emplace_back(ns, name, parameterCount, func, true);
+        this->m_functions.emplace_back(ns, name, parameterCount, adaptFunctionCallback(func), true);
     }
 
     void PatternLanguage::addType(const api::Namespace &ns, const std::string &name, api::FunctionParameterCount parameterCount, const api::TypeCallback &func) {
+        this->m_compiledProgram.reset();
         this->m_parserManager.addBuiltinType(getFunctionName(ns, name), parameterCount, func);
     }
 
@@ -597,12 +733,17 @@ namespace pl {
         std::transform(intervals.begin(), intervals.end(), std::back_inserter(results), [](const auto &interval) {
             ptrn::Pattern* value = interval.value;
 
+            const auto isArrayTemplate = [](const ptrn::Pattern *pattern) {
+                const auto parent = pattern->getParent();
+                return dynamic_cast<const ptrn::PatternArrayStatic*>(parent) != nullptr || dynamic_cast<const ptrn::PatternArrayLazy*>(parent) != nullptr;
+            };
+
             auto parent = value->getParent();
-            while (parent != nullptr && dynamic_cast<const ptrn::PatternArrayStatic*>(parent->getParent()) == nullptr) {
+            while (parent != nullptr && !isArrayTemplate(parent)) {
                 parent = parent->getParent();
             }
 
-            // Handle static array members
+            // Handle members of static and lazy arrays, they share one template for all entries
             if (parent != nullptr) {
                 parent->setOffset(interval.interval.start - (value->getOffset() - parent->getOffset()));
                 parent->clearFormatCache();
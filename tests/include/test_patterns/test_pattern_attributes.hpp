@@ -76,11 +76,17 @@ namespace pl::test {
                 if (varName == "formatTransformTest") {
                     if (pattern->getFormattedValue() != "Hello World")
                         return false;
+                    if (!pattern->hasAttribute("format") || !m_runtime->getPatternsWithAttribute("format").contains(pattern.get()))
+                        return false;
                 } else if (varName == "sealedTest") {
-                    if (!pattern->isSealed())
+                    if (!pattern->isSealed() || pattern->getVisibility() != ptrn::Visibility::Visible)
+                        return false;
+                    if (!pattern->hasAttribute("sealed") || !m_runtime->getPatternsWithAttribute("sealed").contains(pattern.get()))
                         return false;
                 } else if (varName == "hiddenTest") {
-                    if (pattern->getVisibility() != ptrn::Visibility::Hidden)
+                    if (pattern->getVisibility() != ptrn::Visibility::Hidden || !pattern->isSealed())
+                        return false;
+                    if (!m_runtime->getPatternsWithAttribute("hidden").contains(pattern.get()))
                         return false;
                 } else if (varName == "colorTest") {
                     if (pattern->getColor() != 0xFF00FF)
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/pattern_language.hpp>
+#include <pl/core/evaluator.hpp>
+
+namespace pl::test {
+
+    class TestPatternBytecode : public TestPattern {
+    public:
+        TestPatternBytecode(core::Evaluator *evaluator) : TestPattern(evaluator, "Bytecode") { }
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                #pragma engine bytecode
+
+                fn narrow(u8 value) {
+                    u8 doubled = value * 2;
+                    s8 negated = -value;
+                    return doubled + negated;
+                };
+
+                std::assert(narrow(0x81) == 0x81, "Typed parameters and locals didn't truncate");
+                std::assert(narrow(0x181) == 0x81, "Typed parameter didn't truncate argument");
+
+                fn to_float(u32 value) {
+                    float result = value;
+                    result = result / 4;
+                    return result;
+                };
+
+                std::assert(to_float(10) == 2.5, "Float local conversion failed");
+
+                fn to_bool(auto value) {
+                    bool result = value;
+                    char character = value + 0x100;
+                    return result && character == 'A';
+                };
+
+                std::assert(to_bool(0x41), "Boolean and character locals failed");
+                std::assert(!to_bool(0), "Boolean local didn't convert zero");
+
+                fn from_float(auto value) {
+                    u8 unsignedResult = value;
+                    s8 signedResult = value;
+                    return unsignedResult == 0xFF && signedResult == -1;
+                };
+
+                std::assert(from_float(-1.5), "Negative float to integer local conversion failed");
+
+                fn collatz(auto value) {
+                    u32 steps = 0;
+                    while (value != 1) {
+                        value = value % 2 == 0 ? value / 2 : value * 3 + 1;
+                        steps += 1;
+                    }
+                    return steps;
+                };
+
+                std::assert(collatz(27) == 111, "Loop with ternary failed");
+
+                fn loops(u32 limit) {
+                    u32 result = 0;
+                    for (u32 i = 0, i < limit, i += 1) {
+                        if (i == 2)
+                            continue;
+                        if (i == 8)
+                            break;
+
+                        u32 square = i * i;
+                        result += square;
+                    }
+                    return result;
+                };
+
+                std::assert(loops(5) == 26, "Loop with continue failed");
+                std::assert(loops(20) == 136, "Loop with break failed");
+
+                fn short_circuit(auto value) {
+                    return value != 0 && 10 / value == 2 || value == 0;
+                };
+
+                std::assert(short_circuit(5), "Short circuit evaluation failed");
+                std::assert(short_circuit(0), "Short circuit didn't skip right operand");
+                std::assert(!short_circuit(3), "Boolean operator result wrong");
+
+                fn fibonacci(u64 value) {
+                    if (value < 2)
+                        return value;
+                    return fibonacci(value - 1) + fibonacci(value - 2);
+                };
+
+                std::assert(fibonacci(15) == 610, "Recursive calls failed");
+
+                u32 globalValue = 40;
+                fn read_global(auto offset) {
+                    return globalValue + offset;
+                };
+
+                std::assert(read_global(2) == 42, "Global variable access failed");
+
+                struct Pair {
+                    u8 first;
+                    u8 second;
+                };
+
+                fn fallback(auto value) {
+                    Pair pair;
+                    pair.first = value;
+                    return pair.first;
+                };
+
+                std::assert(fallback(0x1FF) == 0xFF, "AST fallback failed");
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            std::ignore = patterns;
+
+            // Make sure the functions actually ran on the VM and didn't all silently fall back to the AST interpreter
+            return m_runtime->getInternals().evaluator->getVirtualMachine().getExecutedProgramCount() > 0;
+        }
+    };
+
+}
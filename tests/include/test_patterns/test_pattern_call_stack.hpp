@@ -0,0 +1,85 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/core/evaluator.hpp>
+
+#include <algorithm>
+
+namespace pl::test {
+
+    class TestPatternCallStack : public TestPattern {
+    public:
+        TestPatternCallStack(core::Evaluator *evaluator) : TestPattern(evaluator, "CallStack") {
+        }
+        ~TestPatternCallStack() override = default;
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                fn fail(u32 depth) {
+                    if (depth == 0)
+                        builtin::std::error("expected");
+                    else
+                        fail(depth - 1);
+                };
+
+                fn main() {
+                    u32 caught = 0;
+                    for (u32 i = 0, i < 32, i += 1) {
+                        try {
+                            fail(8);
+                        } catch {
+                            caught += 1;
+                        }
+                    }
+
+                    std::assert(caught == 32, "errors are caught");
+                };
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            wolv::util::unused(patterns);
+
+            PatternLanguage runtime;
+
+            std::vector<std::string> errorLines;
+            runtime.setLogCallback([&errorLines](auto level, const std::string &message) {
+                if (level == core::LogConsole::Level::Error)
+                    errorLines.push_back(message);
+            });
+
+            const auto result = runtime.executeString(R"(
+                fn inner() {
+                    builtin::std::error("expected");
+                };
+
+                fn outer() {
+                    inner();
+                };
+
+                outer();
+            )");
+            if (result)
+                return false;
+
+            const auto &callStack = runtime.getInternals().evaluator->getCallStack();
+            if (callStack.empty())
+                return false;
+
+            // Frames have to point back into the source they were captured from
+            bool hasSourceLocation = false;
+            for (const auto &[location, node, address] : callStack) {
+                wolv::util::unused(address);
+
+                if (node == nullptr)
+                    return false;
+
+                hasSourceLocation |= location.source != nullptr && location.line != 0;
+            }
+
+            return hasSourceLocation && std::ranges::find(errorLines, "[ Stack Trace ]") != errorLines.end();
+        }
+    };
+
+}
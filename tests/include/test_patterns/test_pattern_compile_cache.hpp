@@ -0,0 +1,58 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+namespace pl::test {
+
+    class TestPatternCompileCache : public TestPattern {
+    public:
+        TestPatternCompileCache(core::Evaluator *evaluator) : TestPattern(evaluator, "CompileCache") {
+        }
+        ~TestPatternCompileCache() override = default;
+
+        void setup() override {
+            m_runtime->setCompileCacheEnabled(true);
+
+            // Pragmas run before the new program is set, so this sees the program of the previous run
+            m_runtime->addPragma("compile_cache_probe", [this](PatternLanguage &runtime, const std::string &) {
+                const auto ast = runtime.getAST();
+                m_previousProgram = ast.empty() ? nullptr : ast.front().get();
+
+                return true;
+            });
+        }
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                #pragma endian big
+                #pragma compile_cache_probe
+
+                import IC;
+
+                u32 value @ 0x00;
+
+                fn main() {
+                    c();
+                    std::assert(value == builtin::std::mem::read_unsigned(0x00, 4, 1), "pragma applied on a cached run");
+                };
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            if (patterns.size() != 1)
+                return false;
+
+            // Recompiling would have created new nodes while the previous program was still alive
+            const auto ast = m_runtime->getAST();
+            return !ast.empty() && ast.front().get() == m_previousProgram;
+        }
+
+        [[nodiscard]] size_t repeatTimes() const override {
+            return 3;
+        }
+
+    private:
+        const core::ast::ASTNode *m_previousProgram = nullptr;
+    };
+
+}
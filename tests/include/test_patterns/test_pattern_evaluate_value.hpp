@@ -0,0 +1,75 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+namespace pl::test {
+
+    class TestPatternEvaluateValue : public TestPattern {
+    public:
+        TestPatternEvaluateValue(core::Evaluator *evaluator) : TestPattern(evaluator, "EvaluateValue") {
+        }
+        ~TestPatternEvaluateValue() override = default;
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                enum Mode : u8 {
+                    Off = 0,
+                    On  = 5
+                };
+
+                struct Header {
+                    u8 first;
+                    u16 second;
+                };
+
+                Header header @ 0x00;
+
+                fn add(auto a, auto b) {
+                    return a + b;
+                };
+
+                fn pick(u32 a, u32 b = 7) {
+                    return b;
+                };
+
+                fn nothing() {
+                };
+
+                fn first_of(auto ... values) {
+                    return add(values);
+                };
+
+                fn first_byte(ref Header value) {
+                    return value.first;
+                };
+
+                u32 calls = 0;
+                fn count_call(u32 value) {
+                    calls += 1;
+                    return value;
+                };
+
+                // Literals, mathematical expressions, casts and ternaries
+                std::assert(add(1, 2) == 3, "Literal arguments failed");
+                std::assert(add(2 * 3, u8(0x1FF)) == 0x105, "Expression and cast arguments failed");
+                std::assert(add(true ? 10 : 20, false ? 10 : 20) == 30, "Ternary arguments failed");
+
+                // Scope resolutions, type operators and rvalues
+                std::assert(add(Mode::On, sizeof(header)) == 8, "Scope resolution and type operator arguments failed");
+                std::assert(add(header.first, header.second) == $[0] + builtin::std::mem::read_unsigned(1, 2, 2), "RValue arguments failed");
+                std::assert(first_byte(header) == $[0], "Pattern argument failed");
+
+                // Nested calls are evaluated exactly once
+                std::assert(add(count_call(1), count_call(2)) == 3 && calls == 2, "Nested call arguments were evaluated more than once");
+
+                // Parameter packs get expanded, default parameters fill up missing arguments
+                std::assert(first_of(4, 5) == 9, "Parameter pack arguments failed");
+                std::assert(pick(1) == 7, "Default parameter failed");
+
+                // Arguments without a value are dropped instead of being passed on
+                std::assert(pick(1, nothing()) == 7, "Void argument wasn't dropped");
+            )";
+        }
+    };
+
+}
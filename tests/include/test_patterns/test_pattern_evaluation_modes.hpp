@@ -0,0 +1,114 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/core/evaluator.hpp>
+
+namespace pl::test {
+
+    class TestPatternEvaluationModes : public TestPattern {
+    public:
+        TestPatternEvaluationModes(core::Evaluator *evaluator) : TestPattern(evaluator, "EvaluationModes") {
+        }
+        ~TestPatternEvaluationModes() override = default;
+
+        void setup() override {
+            m_runtime->setEvaluationMode(core::EvaluationMode::Release);
+        }
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                struct Entry {
+                    u8 value;
+                    u8 next;
+                };
+
+                Entry entries[16] @ 0x00;
+
+                fn fail() {
+                    builtin::std::error("expected");
+                };
+
+                fn main() {
+                    u32 sum = 0;
+                    for (u32 i = 0, i < 16, i += 1)
+                        sum += entries[i].value;
+
+                    u32 caught = 0;
+                    for (u32 i = 0, i < 8, i += 1) {
+                        try {
+                            fail();
+                        } catch {
+                            caught += 1;
+                        }
+                    }
+
+                    std::assert(caught == 8, "errors are still caught in release mode");
+                    std::assert(sum > 0, "sum");
+                };
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            wolv::util::unused(patterns);
+
+            const auto evaluate = [this](core::EvaluationMode mode, PatternLanguage &runtime, bool &breakpointHit) -> std::optional<u128> {
+                runtime.setEvaluationMode(mode);
+                runtime.setDataSource(0x00, 0x100, [](u64 offset, u8 *buffer, size_t size) {
+                    for (size_t i = 0; i < size; i++)
+                        buffer[i] = u8(offset + i + 1);
+                });
+
+                runtime.addFunction({ "std" }, "assert", api::FunctionParameterCount::exactly(2), [](core::Evaluator *, auto params) -> std::optional<core::Token::Literal> {
+                    if (!params[0].toBoolean())
+                        core::err::E0012.throwError(fmt::format("assertion failed \"{0}\"", params[1].toString(false)));
+
+                    return std::nullopt;
+                });
+
+                if (runtime.executeString(this->getSourceCode()) != EXIT_SUCCESS)
+                    return std::nullopt;
+
+                breakpointHit = false;
+                runtime.getInternals().evaluator->addBreakpoint(1);
+                runtime.getInternals().evaluator->setBreakpointHitCallback([&breakpointHit] { breakpointHit = true; });
+
+                auto [exitCode, value] = runtime.executeFunction(R"(
+                    u32 sum = 0;
+                    for (u32 i = 0, i < 10, i += 1) {
+                        if (i % 3 == 0)
+                            sum += i * i;
+                        else
+                            sum ^= i;
+                    }
+                    return sum;
+                )");
+                if (exitCode != 0 || !value.has_value())
+                    return std::nullopt;
+
+                return value->toUnsigned();
+            };
+
+            PatternLanguage debuggableRuntime, releaseRuntime;
+            bool debuggableBreakpointHit = false, releaseBreakpointHit = false;
+            const auto debuggable = evaluate(core::EvaluationMode::Debuggable, debuggableRuntime, debuggableBreakpointHit);
+            const auto release    = evaluate(core::EvaluationMode::Release, releaseRuntime, releaseBreakpointHit);
+            if (!debuggable.has_value() || !release.has_value() || *debuggable != *release)
+                return false;
+
+            // Release mode only drops debugging support, the patterns it creates have to be identical
+            const auto &debuggablePatterns = debuggableRuntime.getPatterns();
+            const auto &releasePatterns    = releaseRuntime.getPatterns();
+            if (debuggablePatterns.size() != releasePatterns.size())
+                return false;
+
+            for (size_t i = 0; i < debuggablePatterns.size(); i++) {
+                if (*debuggablePatterns[i] != *releasePatterns[i])
+                    return false;
+            }
+
+            return debuggableBreakpointHit && !releaseBreakpointHit;
+        }
+    };
+
+}
@@ -428,4 +428,148 @@ namespace pl::test {
         }
     };
 
+    class TestPatternLargeScopeSemantics : public TestPattern {
+    public:
+        TestPatternLargeScopeSemantics(core::Evaluator *evaluator) : TestPattern(evaluator, "LargeScopeSemantics") { }
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                u32 global0 = 0;   u32 global1 = 1;   u32 global2 = 2;   u32 global3 = 3;
+                u32 global4 = 4;   u32 global5 = 5;   u32 global6 = 6;   u32 global7 = 7;
+                u32 global8 = 8;   u32 global9 = 9;   u32 global10 = 10; u32 global11 = 11;
+                u32 global12 = 12; u32 global13 = 13; u32 global14 = 14; u32 global15 = 15;
+                u32 global16 = 16; u32 global17 = 17; u32 global18 = 18; u32 global19 = 19;
+
+                std::assert(global0 + global19 == 19, "Global lookup in large scope failed");
+                global7 = 70;
+                std::assert(global7 == 70, "Global assignment in large scope failed");
+
+                fn sum_globals() {
+                    u32 local0 = 100; u32 local1 = 101; u32 local2 = 102; u32 local3 = 103;
+                    u32 local4 = 104; u32 local5 = 105; u32 local6 = 106; u32 local7 = 107;
+                    u32 local8 = 108; u32 local9 = 109; u32 local10 = 110; u32 local11 = 111;
+                    u32 local12 = 112; u32 local13 = 113; u32 local14 = 114; u32 local15 = 115;
+                    u32 global3 = 300;
+                    local15 = local15 + 1;
+
+                    return global3 + global18 + local0 + local15;
+                };
+
+                std::assert(sum_globals() == 300 + 18 + 100 + 116, "Local shadowing in large scope failed");
+
+                struct Wide {
+                    u8 member0;  u8 member1;  u8 member2;  u8 member3;
+                    u8 member4;  u8 member5;  u8 member6;  u8 member7;
+                    u8 member8;  u8 member9;  u8 member10; u8 member11;
+                    u8 member12; u8 member13; u8 member14; u8 member15;
+                    u8 tail[member1 & 3];
+                };
+
+                Wide wide @ 0x00;
+                std::assert(wide.member15 == $[15], "Member lookup in large struct failed");
+                std::assert(sizeof(wide.tail) == ($[1] & 3), "Member dependent size in large struct failed");
+
+                fn renamed_reference(ref Wide value) {
+                    u32 seen = 0;
+
+                    // While it's passed by reference, the global is only known under the parameter's name.
+                    // Looking it up under its own name fails and rebuilds the global scope's lookup table
+                    try {
+                        seen = wide.member0;
+                    } catch {
+                        seen = 1000;
+                    }
+
+                    return seen + value.member15;
+                };
+
+                std::assert(renamed_reference(wide) == 1000 + $[15], "Reference parameter lookup in large scope failed");
+                std::assert(wide.member15 == $[15], "Variable renamed back after a call not found in large scope");
+
+                struct Recovering {
+                    u8 member0;  u8 member1;  u8 member2;  u8 member3;
+                    u8 member4;  u8 member5;  u8 member6;  u8 member7;
+                    u8 member8;  u8 member9;  u8 member10; u8 member11;
+                    u8 member12; u8 member13; u8 member14; u8 member15;
+
+                    try {
+                        u8 probe;
+                        std::assert(probe == $[16], "Member lookup in failing try block failed");
+                        std::assert(false, "not this layout");
+                    } catch {
+                        u8 fallback;
+                        std::assert(fallback == $[16], "Member declared after rolled back try block not found");
+                    }
+                };
+
+                Recovering recovering @ 0x00;
+                std::assert(recovering.fallback == $[16], "Member of rolled back large struct failed");
+            )";
+        }
+    };
+
+    class TestPatternFormatterHeapSemantics : public TestPattern {
+    public:
+        TestPatternFormatterHeapSemantics(core::Evaluator *evaluator) : TestPattern(evaluator, "FormatterHeapSemantics") { }
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                u32 calls = 0;
+                u8 scratch[32];
+
+                fn format_value(u8 value) {
+                    u8 buffer[16];
+                    buffer[0] = value;
+                    calls += 1;
+                    scratch[1] = 0xAA;
+
+                    return builtin::std::format("{}:{}", buffer[0], calls);
+                };
+
+                struct Value {
+                    u8 x [[format("format_value")]];
+                };
+
+                Value value @ 0x00;
+
+                std::assert(builtin::std::format("{}", value) == builtin::std::format("struct Value {{ x = {}:1 }}", $[0]), "Formatter did not run");
+                std::assert(builtin::std::format("{}", value) == builtin::std::format("struct Value {{ x = {}:1 }}", $[0]), "Formatter heap writes were not rolled back");
+                std::assert(calls == 0, "Formatter modified a global variable");
+                std::assert(scratch[1] == 0, "Formatter modified a global array");
+
+                calls = 5;
+                std::assert(builtin::std::format("{}", value) == builtin::std::format("struct Value {{ x = {}:6 }}", $[0]), "Formatter did not see the current heap");
+                std::assert(calls == 5, "Heap was not restored to the state before the formatter call");
+
+                fn format_inner(u8 value) {
+                    calls += 100;
+                    return builtin::std::format("{}", calls);
+                };
+
+                struct Inner {
+                    u8 y [[format("format_inner")]];
+                };
+
+                Inner inner @ 0x01;
+
+                fn format_outer(u8 value) {
+                    calls += 1;
+                    str nested = builtin::std::format("{}", inner);
+                    calls += 10;
+                    return builtin::std::format("{}:{}", nested, calls);
+                };
+
+                struct Outer {
+                    u8 x [[format("format_outer")]];
+                };
+
+                Outer outer @ 0x02;
+
+                calls = 0;
+                std::assert(builtin::std::format("{}", outer) == "struct Outer { x = struct Inner { y = 101 }:11 }", "Nested formatter did not see or roll back its own writes");
+                std::assert(calls == 0, "Nested formatter heap writes were not rolled back");
+            )";
+        }
+    };
+
 }
@@ -218,6 +218,16 @@ namespace pl::test {
                 std::assert(add_defaults(5) == 12, "Default argument failed");
                 std::assert(add_defaults(5, 9) == 14, "Default argument override failed");
 
+                fn add_many(auto first, auto second = 10, auto third = 100) {
+                    return first + second + third;
+                };
+
+                u32 repeatedSum = 0;
+                for (u32 i = 0, i < 4, i += 1) {
+                    repeatedSum += add_many(i) + add_many(i, 1) + add_many(i, 1, 2);
+                }
+                std::assert(repeatedSum == 874, "Repeated call site with default arguments failed");
+
                 fn factorial(auto value) {
                     if (value <= 1)
                         return 1;
@@ -430,6 +440,46 @@ namespace pl::test {
                 std::assert(nestedAutoCopy.inner.y == 5, "Nested inferred aggregate changed adjacent member");
                 std::assert(nestedAutoCopy.value == 70000, "Nested inferred u16 member was truncated");
                 std::assert(nestedAutoCopySource.inner.x == 4, "Nested inferred aggregate aliased its source");
+
+                struct LocalMemberEntry {
+                    u8 raw;
+                    u32 doubled = raw * 2;
+                    u32 adjusted = doubled;
+                    adjusted = adjusted + 1;
+                };
+
+                LocalMemberEntry localMemberEntries[16] @ 0x00;
+                std::assert(localMemberEntries[0].doubled == $[0] * 2, "First local member value failed");
+                std::assert(localMemberEntries[7].doubled == $[7] * 2, "Middle local member value failed");
+                std::assert(localMemberEntries[15].adjusted == $[15] * 2 + 1, "Last local member assignment failed");
+
+                str grownValue = "a";
+                u32 laterValue = 7;
+                grownValue = grownValue + "bcdefghijklmnopqrstuvwxyz";
+                std::assert(grownValue == "abcdefghijklmnopqrstuvwxyz", "Growing a heap cell below a later cell failed");
+                std::assert(laterValue == 7, "Growing a heap cell changed a later cell");
+
+                fn scoped_locals(u32 value) {
+                    u128 doubled = value * 2;
+                    str suffix = "x";
+                    suffix = suffix + "y";
+                    return doubled + (suffix == "xy");
+                };
+
+                for (u32 i = 0, i < 64, i += 1)
+                    std::assert(scoped_locals(i) == i * 2 + 1, "Heap cells of a left scope were reused incorrectly");
+
+                struct LocalBufferEntry {
+                    u8 raw;
+                    u128 wide = raw;
+                    wide = wide + 1;
+                    str name = "longer than the inline local storage";
+                    name = name + "!";
+                };
+
+                LocalBufferEntry localBufferEntries[4] @ 0x00;
+                std::assert(localBufferEntries[3].wide == $[3] + 1, "Local member filling the inline storage failed");
+                std::assert(localBufferEntries[2].name == "longer than the inline local storage!", "Local member spilling out of the inline storage failed");
             )";
         }
     };
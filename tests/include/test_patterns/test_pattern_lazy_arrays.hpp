@@ -0,0 +1,89 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/patterns/pattern_array_static.hpp>
+#include <pl/patterns/pattern_array_lazy.hpp>
+
+namespace pl::test {
+
+    class TestPatternLazyArrays : public TestPattern {
+    public:
+        TestPatternLazyArrays(core::Evaluator *evaluator) : TestPattern(evaluator, "LazyArrays") {
+        }
+        ~TestPatternLazyArrays() override = default;
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                struct Record {
+                    u32 key;
+                    u16 value;
+                    u8 flags[2];
+                };
+
+                Record records[0x4000] @ 0x00;
+
+                struct Chunk {
+                    u16 tag;
+                    if (std::core::array_index() % 4 == 0)
+                        u16 extra;
+                };
+
+                Chunk chunks[0x400] @ 0x20000;
+
+                fn main() {
+                    u128 sum = 0;
+                    for (u32 i = 0, i < 0x4000, i += 1)
+                        sum += records[i].value + records[i].flags[1];
+
+                    std::assert(addressof(records[0x3FFF].flags[1]) == 0x3FFF * 8 + 7, "lazily created entry offset");
+                    std::assert(records[0x1234].key == builtin::std::mem::read_unsigned(0x1234 * 8, 4, 2), "lazily created entry value");
+
+                    std::assert(addressof(chunks[5]) == 0x20000 + 4 + 2 * 3 + 4, "lazy dynamic array entry offset");
+                    std::assert(sizeof(chunks[8]) == 4 && sizeof(chunks[9]) == 2, "lazy dynamic array entry layout");
+                };
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            if (patterns.size() != 2)
+                return false;
+
+            auto records = dynamic_cast<ptrn::PatternArrayStatic*>(patterns[0].get());
+            if (records == nullptr || records->getEntryCount() != 0x4000)
+                return false;
+
+            const auto entry = records->getEntry(0x2000);
+            if (entry->getOffset() != 0x2000 * 8 || records->getEntry(0x2001)->getOffset() != 0x2001 * 8)
+                return false;
+
+            // Changes made to an entry never leak into later accesses of the same index
+            const auto color = entry->getColor();
+            entry->setColor(~color & 0x00FF'FFFF);
+
+            if (records->getEntry(0x2000)->getColor() != color)
+                return false;
+
+            // Entries of the dynamic array are only kept once per distinct layout
+            auto chunks = dynamic_cast<ptrn::PatternArrayLazy*>(patterns[1].get());
+            if (chunks == nullptr || chunks->getEntryCount() != 0x400 || chunks->getLayoutCount() != 2)
+                return false;
+
+            if (chunks->getSize() != 0x100 * 4 + 0x300 * 2)
+                return false;
+
+            for (u64 index : { 0x000, 0x001, 0x0FF, 0x100, 0x3FF }) {
+                const auto chunk = chunks->getEntry(index);
+                const auto offset = 0x20000 + (index / 4) * 10 + (index % 4 == 0 ? 0 : 4 + (index % 4 - 1) * 2);
+                if (chunk->getOffset() != offset || chunk->getSize() != (index % 4 == 0 ? 4 : 2) || chunk->getVariableName() != fmt::format("[{}]", index))
+                    return false;
+            }
+
+            const auto chunk = chunks->getEntry(0x100);
+            chunk->setOffset(0);
+
+            return chunks->getEntry(0x100)->getOffset() == 0x20000 + 0x40 * 10;
+        }
+    };
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/patterns/pattern_pointer.hpp>
+
+namespace pl::test {
+
+    class TestPatternLazyPointers : public TestPattern {
+    public:
+        TestPatternLazyPointers(core::Evaluator *evaluator) : TestPattern(evaluator, "LazyPointers") {
+        }
+        ~TestPatternLazyPointers() override = default;
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                struct Header {
+                    u32 magic;
+                    u16 version;
+                    u16 flags;
+                };
+
+                Header *first : u8 @ 0x00;
+                Header *second : u8 @ 0x00 [[lazy]];
+                Header *third : u8 @ 0x01 [[lazy]];
+                Header *fourth : u8 @ 0x02 [[lazy]];
+
+                fn main() {
+                    std::assert(third.magic == builtin::std::mem::read_unsigned(builtin::std::mem::read_unsigned(0x01, 1, 2), 4, 2), "lazily created pointee value");
+                };
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            if (patterns.size() != 4)
+                return false;
+
+            auto first  = dynamic_cast<ptrn::PatternPointer*>(patterns[0].get());
+            auto second = dynamic_cast<ptrn::PatternPointer*>(patterns[1].get());
+            auto fourth = dynamic_cast<ptrn::PatternPointer*>(patterns[3].get());
+            if (first == nullptr || second == nullptr || fourth == nullptr)
+                return false;
+
+            // Pointees that haven't been accessed yet aren't created when listing the children of a pointer
+            if (fourth->getChildren().size() != 1)
+                return false;
+
+            // Pointers to the same address get their own copy of the pointee under their own name
+            const auto &firstPointee  = first->getPointedAtPattern();
+            const auto &secondPointee = second->getPointedAtPattern();
+            if (second->getPointeeTable() == nullptr || firstPointee == secondPointee)
+                return false;
+            if (secondPointee->getOffset() != firstPointee->getOffset() || secondPointee->getVariableName() != "*(second)")
+                return false;
+
+            // Pointees that haven't been accessed during evaluation get created from the type's prototype
+            const auto &pointee = fourth->getPointedAtPattern();
+            if (pointee == nullptr || pointee->getOffset() != u64(fourth->getPointedAtAddress()) ||
+                pointee->getTypeName() != "Header" || pointee->getSize() != 8)
+                return false;
+
+            // Every created pointee gets its own color instead of the one of the pattern it was copied from
+            return pointee->getColor() != secondPointee->getColor();
+        }
+    };
+
+}
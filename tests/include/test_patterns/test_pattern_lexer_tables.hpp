@@ -0,0 +1,68 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/api.hpp>
+#include <pl/core/lexer.hpp>
+#include <pl/core/tokens.hpp>
+
+namespace pl::test {
+
+    class TestPatternLexerTables : public TestPattern {
+    public:
+        TestPatternLexerTables(core::Evaluator *evaluator) : TestPattern(evaluator, "LexerTables") {
+        }
+        ~TestPatternLexerTables() override = default;
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                str plain = "plain";
+                str escaped = "esc\x41ped";
+                std::assert(plain == "plain", "string without escapes");
+                std::assert(escaped == "escAped", "string with escapes");
+                std::assert(true && !false, "constants");
+                std::assert(sizeof(u32) == 4, "named operator");
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            std::ignore = patterns;
+
+            // Every registered word and operator has to come out of the lookup tables as the registered token
+            const auto checkAll = [](const std::map<std::string_view, core::Token> &registry) {
+                for (const auto &[name, expected] : registry) {
+                    if (!lexesTo(name, expected))
+                        return false;
+                }
+
+                return true;
+            };
+
+            if (!checkAll(core::Token::Keywords()) || !checkAll(core::Token::Types()) || !checkAll(core::Token::Operators()))
+                return false;
+
+            // Operators and comments at the very end of the source must not read past it
+            for (const auto source : { "a ==", "a =", "a // comment", "a /* comment" }) {
+                core::Lexer lexer;
+                api::Source content(source);
+                std::ignore = lexer.lex(&content);
+            }
+
+            return true;
+        }
+
+    private:
+        static bool lexesTo(std::string_view name, const core::Token &expected) {
+            core::Lexer lexer;
+            api::Source source { std::string(name) };
+
+            auto result = lexer.lex(&source);
+            if (!result.isOk())
+                return false;
+
+            const auto &tokens = result.unwrap();
+            return tokens.size() == 2 && tokens[0].type == expected.type && tokens[0] == expected.value && tokens[0].location.length == name.size();
+        }
+    };
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <span>
+
+namespace pl::test {
+
+    class TestPatternNativeFunctions : public TestPattern {
+    public:
+        TestPatternNativeFunctions(core::Evaluator *evaluator) : TestPattern(evaluator, "NativeFunctions") {
+        }
+        ~TestPatternNativeFunctions() override = default;
+
+        void setup() override {
+            m_runtime->addFunction({ "test" }, "sum", api::FunctionParameterCount::atLeast(1), [](core::Evaluator *, std::span<const core::Token::Literal> params) -> std::optional<core::Token::Literal> {
+                u128 result = 0;
+                for (const auto &param : params)
+                    result += param.toUnsigned();
+
+                return result;
+            });
+
+            m_runtime->addFunction({ "test" }, "sum_vector", api::FunctionParameterCount::atLeast(1), [](core::Evaluator *, const std::vector<core::Token::Literal> &params) -> std::optional<core::Token::Literal> {
+                u128 result = 0;
+                for (const auto &param : params)
+                    result += param.toUnsigned();
+
+                return result;
+            });
+        }
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                fn twice(u32 value) {
+                    return test::sum(value, value);
+                };
+
+                fn main() {
+                    std::assert(test::sum(1, test::sum(2, test::sum(3, 4), 5), 6) == 21, "nested span calls");
+                    std::assert(test::sum_vector(1, test::sum(2, 3), test::sum_vector(4)) == 10, "mixed span and vector calls");
+                    std::assert(test::sum(twice(1), twice(twice(2)), test::sum(1, 2, 3, 4, 5, 6, 7, 8, 9, 10)) == 65, "calls through user functions");
+
+                    u32 total = 0;
+                    for (u32 i = 0, i < 100, i += 1)
+                        total = test::sum(total, i);
+                    std::assert(total == 4950, "repeated span calls");
+                };
+            )";
+        }
+    };
+
+}
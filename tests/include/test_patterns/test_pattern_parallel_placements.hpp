@@ -0,0 +1,103 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/pattern_language.hpp>
+#include <pl/core/evaluator.hpp>
+
+#include <wolv/io/file.hpp>
+
+#include <cstring>
+
+namespace pl::test {
+
+    class TestPatternParallelPlacements : public TestPattern {
+    public:
+        TestPatternParallelPlacements(core::Evaluator *evaluator) : TestPattern(evaluator, "ParallelPlacements") {
+        }
+        ~TestPatternParallelPlacements() override = default;
+
+        void setup() override {
+            m_runtime->setEvaluationMode(core::EvaluationMode::Release);
+            m_runtime->setWorkerCount(4);
+
+            // Workers read concurrently, the default test data source seeks in a shared file
+            wolv::io::File testData("test_data", wolv::io::File::Mode::Read);
+            auto data = std::make_shared<std::vector<u8>>(testData.readVector());
+            m_runtime->setDataSource(0x00, data->size(), [data](u64 offset, u8 *buffer, u64 size) {
+                if (offset + size <= data->size())
+                    std::memcpy(buffer, data->data() + offset, size);
+            });
+        }
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                struct Header {
+                    u32 magic;
+                    u16 version;
+                    u8 flags[2];
+                };
+
+                Header header0 @ 0x00;
+                Header header1 @ 0x08;
+                u32 value0 @ 0x10;
+                u32 values[4] @ 0x14;
+                Header header2 @ 0x24;
+                u16 value1 @ 0x2C;
+
+                u8 next @ $;
+
+                Header header3 @ 0x30;
+                Header header4 @ 0x38;
+
+                fn main() {
+                    std::assert(header1.magic == builtin::std::mem::read_unsigned(0x08, 4, 2), "header read by a worker");
+                    std::assert(values[3] == builtin::std::mem::read_unsigned(0x20, 4, 2), "array read by a worker");
+                    std::assert(addressof(next) == 0x2E, "cursor continues after the last placement");
+                };
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            constexpr static std::array<std::pair<std::string_view, u64>, 9> Expected = {{
+                { "header0", 0x00 }, { "header1", 0x08 }, { "value0", 0x10 }, { "values", 0x14 }, { "header2", 0x24 },
+                { "value1", 0x2C }, { "next", 0x2E }, { "header3", 0x30 }, { "header4", 0x38 }
+            }};
+
+            if (patterns.size() != Expected.size())
+                return false;
+
+            // Results are merged back in source order, no matter which worker created them
+            for (size_t i = 0; i < Expected.size(); i++) {
+                const auto &[name, offset] = Expected[i];
+                if (patterns[i]->getVariableName() != name || patterns[i]->getOffset() != offset)
+                    return false;
+            }
+
+            if (patterns[0]->getTypeName() != "Header" || patterns[0]->getSize() != 8)
+                return false;
+
+            // Patterns created by workers count towards the run's pattern count, every header has three members on top of itself
+            if (m_runtime->getCreatedPatternCount() < patterns.size() + 5 * 3)
+                return false;
+
+            // The pattern limit applies to all workers together, no single worker gets close to it here
+            PatternLanguage limitedRuntime;
+            limitedRuntime.setEvaluationMode(core::EvaluationMode::Release);
+            limitedRuntime.setWorkerCount(4);
+            limitedRuntime.setDataSource(0x00, 0x100, [](u64, u8 *buffer, size_t size) {
+                std::memset(buffer, 0x00, size);
+            });
+            limitedRuntime.addFunction({ "std" }, "assert", api::FunctionParameterCount::exactly(2), [](core::Evaluator *, auto) -> std::optional<core::Token::Literal> {
+                return std::nullopt;
+            });
+
+            if (limitedRuntime.executeString("#pragma pattern_limit 20\n" + this->getSourceCode()) == EXIT_SUCCESS)
+                return false;
+
+            const auto &error = limitedRuntime.getEvalError();
+            return error.has_value() && error->message.contains("Pattern count exceeded");
+        }
+    };
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <utility>
+
+namespace pl::test {
+
+    class TestPatternPatternArena : public TestPattern {
+    public:
+        TestPatternPatternArena(core::Evaluator *evaluator) : TestPattern(evaluator, "PatternArena") {
+        }
+        ~TestPatternPatternArena() override = default;
+
+        void setup() override {
+            m_capturedPattern.reset();
+            m_runtime->setPatternArenaEnabled(true);
+
+            m_runtime->addFunction({ "test" }, "capture", api::FunctionParameterCount::exactly(1), [this](core::Evaluator *, std::span<const core::Token::Literal> params) -> std::optional<core::Token::Literal> {
+                m_capturedPattern = params[0].toPattern();
+
+                return std::nullopt;
+            });
+        }
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                struct Entry {
+                    u8 value [[color("FF0000")]];
+                    u8 other;
+                };
+
+                struct Header {
+                    Entry entries[8];
+                    u16 count;
+                };
+
+                Header header @ 0x00;
+                Header headers[4] @ 0x10;
+
+                fn main() {
+                    test::capture(header.entries[3]);
+                    std::assert(header.entries[3].value == $[6], "arena pattern value");
+                    std::assert(headers[2].entries[7].other == $[0x10 + 2 * 18 + 15], "cloned arena pattern value");
+                };
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            if (patterns.size() != 2 || m_runtime->getInternals().evaluator->getPatternArena() == nullptr)
+                return false;
+
+            // Patterns captured by earlier runs are released while the next run is already using a new arena
+            auto capturedPattern = std::exchange(m_capturedPattern, nullptr);
+
+            return capturedPattern != nullptr && capturedPattern->getOffset() == 6 && capturedPattern->getSize() == 2;
+        }
+
+        [[nodiscard]] size_t repeatTimes() const override {
+            return 3;
+        }
+
+    private:
+        mutable std::shared_ptr<ptrn::Pattern> m_capturedPattern;
+    };
+
+}
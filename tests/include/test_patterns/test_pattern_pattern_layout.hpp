@@ -0,0 +1,58 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/patterns/pattern_unsigned.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace pl::test {
+
+    class TestPatternPatternLayout : public TestPattern {
+    public:
+        TestPatternPatternLayout(core::Evaluator *evaluator) : TestPattern(evaluator, "PatternLayout") {
+        }
+        ~TestPatternPatternLayout() override = default;
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                u8 value @ 0x00 [[color("FF0000"), name("Value")]];
+                be u16 bigValue @ 0x02;
+
+                fn main() {
+                    std::assert(value == $[0], "value");
+                };
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            // Large pattern trees are dominated by leaf patterns, keep them from growing again.
+            // The bound is derived from the members that are meant to be stored inline so it holds for every standard library
+            constexpr size_t InlineMembersSize =
+                sizeof(void*) +                                         // vtable
+                sizeof(std::enable_shared_from_this<ptrn::Pattern>) +
+                sizeof(core::Evaluator*) +                              // m_evaluator
+                sizeof(std::unique_ptr<int>) +                          // m_coldData
+                sizeof(std::weak_ptr<ptrn::Pattern>) +                  // m_parent
+                2 * sizeof(hlp::StringInterner::Handle) +               // m_variableName, m_typeName
+                sizeof(u64) + sizeof(size_t) + 2 * sizeof(u64) +        // m_offset, m_size, m_section, m_arrayIndex
+                2 * sizeof(u32) +                                       // m_line, m_color
+                2 * sizeof(u8);                                         // flags, m_attributeFlags
+            constexpr size_t MaxPatternSize = InlineMembersSize + alignof(std::max_align_t);
+
+            if (sizeof(ptrn::Pattern) > MaxPatternSize || sizeof(ptrn::PatternUnsigned) > MaxPatternSize)
+                return false;
+
+            if (patterns.size() != 2)
+                return false;
+
+            const auto &value = patterns[0];
+            const auto &bigValue = patterns[1];
+
+            return value->getDisplayName() == "Value" && value->getColor() == 0x0000FF && value->getEndian() == std::endian::little &&
+                   bigValue->hasOverriddenEndian() && bigValue->getEndian() == std::endian::big;
+        }
+    };
+
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/patterns/pattern_struct.hpp>
+
+namespace pl::test {
+
+    class TestPatternPatternNames : public TestPattern {
+    public:
+        TestPatternPatternNames(core::Evaluator *evaluator) : TestPattern(evaluator, "PatternNames") {
+        }
+        ~TestPatternPatternNames() override = default;
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                struct Inner {
+                    u8 value;
+                };
+
+                struct Outer {
+                    u8 value;
+                    Inner inner;
+                    Inner inners[2];
+                };
+
+                Outer outer @ 0x00;
+
+                fn main() {
+                    std::assert(builtin::std::core::has_member(outer, "value"), "has_member on existing member");
+                    std::assert(builtin::std::core::has_member(outer.inner, "value"), "has_member on shared name");
+                    std::assert(!builtin::std::core::has_member(outer, "missing"), "has_member on missing member");
+                    std::assert(!builtin::std::core::has_member(outer, ""), "has_member on empty name");
+                };
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            if (patterns.size() != 1)
+                return false;
+
+            auto outer = dynamic_cast<ptrn::PatternStruct*>(patterns[0].get());
+            if (outer == nullptr || outer->getEntryCount() != 3)
+                return false;
+
+            const auto value = outer->getEntry(0);
+            const auto innerValue = dynamic_cast<ptrn::PatternStruct*>(outer->getEntry(1).get())->getEntry(0);
+
+            return outer->getVariableName() == "outer" && outer->getTypeName() == "Outer" &&
+                   value->hasVariableName("value") && !value->hasVariableName("valu") &&
+                   value->hasSameVariableName(*innerValue) && !value->hasSameVariableName(*outer) &&
+                   outer->getEntry(2)->getTypeName() == "Inner";
+        }
+    };
+
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/core/resolvers.hpp>
+
+#include <wolv/io/file.hpp>
+
+namespace pl::test {
+
+    class TestPatternSourceCache : public TestPattern {
+    public:
+        TestPatternSourceCache(core::Evaluator *evaluator) : TestPattern(evaluator, "SourceCache") {
+        }
+        ~TestPatternSourceCache() override = default;
+
+        void setup() override {
+            std::error_code error;
+            std::fs::create_directories(getIncludePath(), error);
+            writeInclude("u8 included @ 0x00;\n");
+
+            m_runtime->setIncludePaths({ getIncludePath() });
+        }
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                #include <source_cache.pat>
+
+                std::assert(included == $[0], "included file was read");
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            if (patterns.size() != 1)
+                return false;
+
+            core::resolvers::FileResolver resolver({ getIncludePath() });
+
+            // Resolving an unchanged file again shares the buffer that was read the first time
+            const auto first = resolver.resolve("source_cache.pat");
+            const auto second = resolver.resolve("source_cache.pat");
+            if (!first.isOk() || !second.isOk() || first.unwrap().getBuffer() != second.unwrap().getBuffer())
+                return false;
+
+            // A different size is enough to detect the change even if the modification time didn't tick
+            writeInclude("u16 included @ 0x00;\n");
+            const auto changed = resolver.resolve("source_cache.pat");
+
+            return changed.isOk() && changed.unwrap().content == "u16 included @ 0x00;\n" && first.unwrap().content == "u8 included @ 0x00;\n";
+        }
+
+    private:
+        static std::fs::path getIncludePath() {
+            return std::fs::temp_directory_path() / "pl_source_cache_test";
+        }
+
+        static void writeInclude(const std::string &content) {
+            wolv::io::File file(getIncludePath() / "source_cache.pat", wolv::io::File::Mode::Create);
+            file.writeString(content);
+        }
+    };
+
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/core/evaluator.hpp>
+#include <pl/patterns/pattern_struct.hpp>
+
+namespace pl::test {
+
+    class TestPatternSpeculation : public TestPattern {
+    public:
+        TestPatternSpeculation(core::Evaluator *evaluator) : TestPattern(evaluator, "Speculation") {
+        }
+        ~TestPatternSpeculation() override = default;
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                struct Probe {
+                    try {
+                        u32 magic;
+                        u32 length;
+                        std::assert(false, "not this layout");
+                    } catch {
+                        u8 first;
+                    }
+
+                    u8 second;
+                };
+
+                Probe probe @ 0x00;
+
+                struct WideProbe {
+                    u8 member0;  u8 member1;  u8 member2;  u8 member3;
+                    u8 member4;  u8 member5;  u8 member6;  u8 member7;
+                    u8 member8;  u8 member9;  u8 member10; u8 member11;
+                    u8 member12; u8 member13; u8 member14; u8 member15;
+
+                    try {
+                        u32 magic;
+                        u32 length;
+                        std::assert(magic == 0 && length == 0 && false, "not this layout");
+                    } catch {
+                        u8 first;
+                        u8 second;
+                        std::assert(first == $[16] && second == $[17], "members after rollback not found");
+                    }
+
+                    u8 third;
+                };
+
+                WideProbe wideProbe @ 0x00;
+
+                fn fail() {
+                    builtin::std::error("expected");
+                };
+
+                fn main() {
+                    u32 caught = 0;
+                    for (u32 i = 0, i < 16, i += 1) {
+                        try {
+                            u32 temporary = i;
+                            fail();
+                        } catch {
+                            caught += 1;
+                        }
+                    }
+
+                    std::assert(caught == 16, "errors are caught");
+                };
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            if (patterns.size() != 2)
+                return false;
+
+            auto probe = dynamic_cast<ptrn::PatternStruct*>(patterns[0].get());
+            if (probe == nullptr || probe->getEntryCount() != 2)
+                return false;
+
+            // Scopes large enough to use the slot table have to roll back the same way
+            auto wideProbe = dynamic_cast<ptrn::PatternStruct*>(patterns[1].get());
+            if (wideProbe == nullptr || wideProbe->getEntryCount() != 19 || wideProbe->getSize() != 19)
+                return false;
+            if (wideProbe->getEntry(16)->getVariableName() != "first" || wideProbe->getEntry(18)->getVariableName() != "third")
+                return false;
+
+            // Frames of errors that were caught must not stay around after rolling back
+            if (!m_runtime->getInternals().evaluator->getCallStack().empty())
+                return false;
+
+            return probe->getSize() == 2 &&
+                   probe->getEntry(0)->getVariableName() == "first" && probe->getEntry(0)->getOffset() == 0x00 &&
+                   probe->getEntry(1)->getVariableName() == "second" && probe->getEntry(1)->getOffset() == 0x01;
+        }
+    };
+
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/patterns/pattern_array_dynamic.hpp>
+#include <pl/patterns/pattern_array_static.hpp>
+
+namespace pl::test {
+
+    class TestPatternStaticLayout : public TestPattern {
+    public:
+        TestPatternStaticLayout(core::Evaluator *evaluator) : TestPattern(evaluator, "StaticLayout") {
+        }
+        ~TestPatternStaticLayout() override = default;
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                enum Kind : u8 {
+                    A, B, C
+                };
+
+                struct Inner {
+                    u8 x, y;
+                };
+
+                struct Record {
+                    Kind kind;
+                    be u16 value [[color("FF0000")]];
+                    padding[1];
+                    Inner inner[2];
+                };
+
+                struct Conditional {
+                    u8 tag;
+                    if (tag == 0x00)
+                        u8 value;
+                };
+
+                Record records[0x10] @ 0x00;
+                Conditional conditionals[4] @ 0x00;
+
+                std::assert(sizeof(records) == 0x80, "static array size");
+                std::assert(addressof(records[3].value) == 3 * 8 + 1, "static array entry offset");
+                std::assert(addressof(records[3].inner[1].y) == 3 * 8 + 7, "nested static array entry offset");
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            if (patterns.size() != 2)
+                return false;
+
+            auto records = dynamic_cast<ptrn::PatternArrayStatic*>(patterns[0].get());
+            auto conditionals = dynamic_cast<ptrn::PatternArrayDynamic*>(patterns[1].get());
+            if (records == nullptr || conditionals == nullptr)
+                return false;
+
+            return records->getEntryCount() == 0x10 && records->getTypeName() == "Record" &&
+                   records->getEntry(5)->getOffset() == 5 * 8 &&
+                   conditionals->getEntryCount() == 4;
+        }
+    };
+
+}
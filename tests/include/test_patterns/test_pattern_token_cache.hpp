@@ -0,0 +1,100 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/core/lexer.hpp>
+#include <pl/core/token_cache.hpp>
+
+namespace pl::test {
+
+    class TestPatternTokenCache : public TestPattern {
+    public:
+        TestPatternTokenCache(core::Evaluator *evaluator) : TestPattern(evaluator, "TokenCache") {
+        }
+        ~TestPatternTokenCache() override = default;
+
+        void setup() override {
+            std::error_code error;
+            std::fs::remove_all(getCachePath(), error);
+
+            m_runtime->setTokenCachePath(getCachePath());
+            (void)m_runtime->addVirtualSource(ImportedSource, "TokenCacheImport");
+        }
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                import TokenCacheImport;
+
+                u8 value @ 0x00;
+
+                fn main() {
+                    std::assert(cached::value() == 0x51, "numeric tokens loaded from the cache");
+                    std::assert(cached::name() == "cached", "string tokens loaded from the cache");
+                };
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            if (patterns.size() != 1)
+                return false;
+
+            api::Source source(ImportedSource, "TokenCacheImport");
+            auto entry = core::TokenCache(getCachePath()).load(&source);
+            if (!entry.has_value())
+                return false;
+
+            // Cached tokens need to be indistinguishable from freshly lexed ones
+            core::Lexer lexer;
+            const auto [tokens, errors] = lexer.lex(&source);
+            if (!tokens.has_value() || tokens->size() != entry->tokens.size() || entry->longestLineLength != lexer.getLongestLineLength())
+                return false;
+
+            for (size_t i = 0; i < tokens->size(); i++) {
+                const auto &lexed = (*tokens)[i];
+                const auto &cached = entry->tokens[i];
+
+                if (lexed.type != cached.type || lexed != cached.value || lexed.location != cached.location || lexed.location.length != cached.location.length)
+                    return false;
+            }
+
+            // Entries holding values outside of the token enums are rejected instead of turned into invalid tokens
+            api::Source corruptedSource("u8 corrupted;", "TokenCacheCorrupted");
+            const core::TokenCache cache(getCachePath());
+            const auto loadsToken = [&](const core::Token &token) {
+                cache.store(&corruptedSource, { { token }, corruptedSource.content.size() });
+                return cache.load(&corruptedSource).has_value();
+            };
+
+            const core::Location location = { &corruptedSource, 1, 1, 2 };
+            if (!loadsToken(core::Token(core::Token::Type::ValueType, core::Token::ValueType::Unsigned8Bit, location)))
+                return false;
+
+            return !loadsToken(core::Token(core::Token::Type(0xFF), core::Token::ValueType::Unsigned8Bit, location)) &&
+                   !loadsToken(core::Token(core::Token::Type::ValueType, core::Token::ValueType(0x12), location)) &&
+                   !loadsToken(core::Token(core::Token::Type::Keyword, core::Token::Keyword(0xFF), location)) &&
+                   !loadsToken(core::Token(core::Token::Type::Identifier, core::Token::Identifier("corrupted", core::Token::Identifier::IdentifierType(0xFF)), location));
+        }
+
+        [[nodiscard]] size_t repeatTimes() const override {
+            return 2;
+        }
+
+    private:
+        static std::fs::path getCachePath() {
+            return std::fs::temp_directory_path() / "pl_token_cache_test";
+        }
+
+        constexpr static auto ImportedSource = R"(
+            #pragma once
+
+            /// Values used by the token cache test
+            namespace cached {
+                // Mixes integer and character literals
+                fn value() { return 0x10 + 'A'; };
+                fn name() { return "cached"; };
+                fn ratio() { return 1.5; };
+            }
+        )";
+    };
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/core/evaluator.hpp>
+#include <pl/patterns/pattern_struct.hpp>
+
+namespace pl::test {
+
+    class TestPatternTypeLayoutCache : public TestPattern {
+    public:
+        TestPatternTypeLayoutCache(core::Evaluator *evaluator) : TestPattern(evaluator, "TypeLayoutCache") {
+        }
+        ~TestPatternTypeLayoutCache() override = default;
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                struct Header {
+                    u16 magic;
+                    u8 version;
+                    u8 flags [[comment("flags")]];
+                };
+
+                struct Container {
+                    Header first;
+                    u8 gap;
+                    Header second;
+                };
+
+                Header a @ 0x00;
+                Header b @ 0x10;
+                be Header c @ 0x20;
+                Container container @ 0x40;
+
+                std::assert(addressof(b.flags) == 0x13, "cached layout is rebased");
+                std::assert(addressof(container.second.version) == 0x47, "cached layout is rebased inside of structs");
+                std::assert(b.magic == builtin::std::mem::read_unsigned(0x10, 2, 2), "cached layout reads its own data");
+                std::assert(c.magic == builtin::std::mem::read_unsigned(0x20, 2, 1), "cached layout keeps endianness apart");
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            if (patterns.size() != 4)
+                return false;
+
+            auto b = dynamic_cast<ptrn::PatternStruct*>(patterns[1].get());
+            auto container = dynamic_cast<ptrn::PatternStruct*>(patterns[3].get());
+            if (b == nullptr || container == nullptr)
+                return false;
+
+            auto second = dynamic_cast<ptrn::PatternStruct*>(container->getEntry(2).get());
+            if (second == nullptr)
+                return false;
+
+            // Every instance has to be registered just like a freshly created one
+            const auto &commented = m_runtime->getInternals().evaluator->getPatternsWithAttribute("comment");
+
+            return b->getOffset() == 0x10 && b->getSize() == 4 && b->getEntry(3)->getOffset() == 0x13 &&
+                   second->getOffset() == 0x45 && second->getEntry(0)->getOffset() == 0x45 &&
+                   commented.size() == 5;
+        }
+    };
+
+}
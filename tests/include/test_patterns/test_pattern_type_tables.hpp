@@ -0,0 +1,69 @@
+#pragma once
+
+#include "test_pattern.hpp"
+
+#include <pl/core/type_table.hpp>
+
+namespace pl::test {
+
+    class TestPatternTypeTables : public TestPattern {
+    public:
+        TestPatternTypeTables(core::Evaluator *evaluator) : TestPattern(evaluator, "TypeTables") {
+        }
+        ~TestPatternTypeTables() override = default;
+
+        [[nodiscard]] std::string getSourceCode() const override {
+            return R"(
+                using Global = u8;
+
+                namespace a {
+                    using Outer = u16;
+
+                    namespace b {
+                        using Inner = u32;
+
+                        Outer outer @ 0x00;
+                        b::Inner qualified @ 0x00;
+                    }
+                }
+
+                namespace a::b {
+                    Inner reopened @ 0x00;
+                    Global global @ 0x00;
+                }
+
+                a::b::Inner full @ 0x00;
+
+                std::assert(sizeof(outer) == 2, "type of the enclosing namespace");
+                std::assert(sizeof(qualified) == 4, "partially qualified type");
+                std::assert(sizeof(reopened) == 4, "type of a reopened namespace");
+                std::assert(sizeof(global) == 1, "global type");
+                std::assert(sizeof(full) == 4, "fully qualified type");
+            )";
+        }
+
+        [[nodiscard]] bool runChecks(const std::vector<std::shared_ptr<ptrn::Pattern>> &patterns) const override {
+            std::ignore = patterns;
+
+            core::TypeTable table;
+            const auto type = std::make_shared<core::ast::ASTNodeTypeDecl>("a::b::Type");
+            const auto scopeA = table.getScope(core::TypeTable::GlobalScope, "a");
+            const auto scopeB = table.getScope(scopeA, "b");
+
+            if (!table.emplace(scopeB, "Type", type) || table.emplace("a::b::Type", type))
+                return false;
+            if (table.getQualifiedName(scopeB, "Type") != "a::b::Type" || table.getQualifiedName(scopeB) != "a::b")
+                return false;
+
+            // Lookups from inside nested namespaces must not require the name to be spelled out fully
+            const std::vector chain = { scopeA, scopeB };
+            if (table.resolve(chain, "Type") == nullptr || table.resolve(chain, "b::Type") == nullptr || table.resolve(chain, "a::b::Type") == nullptr)
+                return false;
+            if (table.resolve({ }, "Type") != nullptr || table.find("b::Type") != nullptr || table.find("a::b") != nullptr)
+                return false;
+
+            return table.size() == 1 && table.begin()->first == "a::b::Type";
+        }
+    };
+
+}
@@ -36,6 +36,25 @@
 #include "test_patterns/test_pattern_language_semantics.hpp"
 #include "test_patterns/test_pattern_extended_semantics.hpp"
 #include "test_patterns/test_pattern_error_semantics.hpp"
+#include "test_patterns/test_pattern_bytecode.hpp"
+#include "test_patterns/test_pattern_native_functions.hpp"
+#include "test_patterns/test_pattern_pattern_arena.hpp"
+#include "test_patterns/test_pattern_pattern_layout.hpp"
+#include "test_patterns/test_pattern_pattern_names.hpp"
+#include "test_patterns/test_pattern_evaluation_modes.hpp"
+#include "test_patterns/test_pattern_call_stack.hpp"
+#include "test_patterns/test_pattern_speculation.hpp"
+#include "test_patterns/test_pattern_static_layout.hpp"
+#include "test_patterns/test_pattern_type_layout_cache.hpp"
+#include "test_patterns/test_pattern_lazy_arrays.hpp"
+#include "test_patterns/test_pattern_lazy_pointers.hpp"
+#include "test_patterns/test_pattern_parallel_placements.hpp"
+#include "test_patterns/test_pattern_compile_cache.hpp"
+#include "test_patterns/test_pattern_token_cache.hpp"
+#include "test_patterns/test_pattern_source_cache.hpp"
+#include "test_patterns/test_pattern_lexer_tables.hpp"
+#include "test_patterns/test_pattern_type_tables.hpp"
+#include "test_patterns/test_pattern_evaluate_value.hpp"
 
 static pl::core::Evaluator s_evaluator;
 
@@ -84,6 +103,8 @@ std::array Tests = {
     TEST(NamespaceSemantics),
     TEST(ArrayAlgorithmSemantics),
     TEST(AliasAggregateSemantics),
+    TEST(LargeScopeSemantics),
+    TEST(FormatterHeapSemantics),
     TEST(DivisionByZeroFail),
     TEST(ModuloByZeroFail),
     TEST(ArrayOutOfBoundsFail),
@@ -95,4 +116,23 @@ std::array Tests = {
     TEST(UndefinedFunctionFail),
     TEST(DuplicateVariableFail),
     TEST(StaticArrayRangeOverflowFail),
+    TEST(Bytecode),
+    TEST(NativeFunctions),
+    TEST(PatternArena),
+    TEST(PatternLayout),
+    TEST(PatternNames),
+    TEST(EvaluationModes),
+    TEST(CallStack),
+    TEST(Speculation),
+    TEST(StaticLayout),
+    TEST(TypeLayoutCache),
+    TEST(LazyArrays),
+    TEST(LazyPointers),
+    TEST(ParallelPlacements),
+    TEST(CompileCache),
+    TEST(TokenCache),
+    TEST(SourceCache),
+    TEST(LexerTables),
+    TEST(TypeTables),
+    TEST(EvaluateValue),
 };